@@ -8,6 +8,7 @@
 #include "fsl_common.h"
 #include "fsl_debug_console.h"
 #include "board.h"
+#include "fsl_lpuart.h"
 #if defined(SDK_I2C_BASED_COMPONENT_USED) && SDK_I2C_BASED_COMPONENT_USED
 #include "fsl_lpi2c.h"
 #endif /* SDK_I2C_BASED_COMPONENT_USED */
@@ -31,6 +32,9 @@ void BOARD_InitDebugConsole(void)
 
     DbgConsole_Init(BOARD_DEBUG_UART_INSTANCE, BOARD_DEBUG_UART_BAUDRATE, BOARD_DEBUG_UART_TYPE,
                     BOARD_DEBUG_UART_CLK_FREQ);
+
+    /* Keep the console running across BOARD_BootClockxxx calls, it is stopped by DbgConsole_Deinit. */
+    LPUART_EnableClockChangeTracking((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR, BOARD_DEBUG_UART_BAUDRATE);
 }
 
 #if defined(SDK_I2C_BASED_COMPONENT_USED) && SDK_I2C_BASED_COMPONENT_USED
@@ -94,6 +94,9 @@ void BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t LowpowerVoltageLevel, sp
     spc_sram_voltage_config_t sramOption;
     spc_bandgap_mode_t bandgapMode;
 
+    /* Let the drivers running on the clocks being changed finish their ongoing transfers */
+    CLOCK_NotifyChange(kCLOCK_ChangeBefore);
+
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
@@ -154,6 +157,9 @@ void BOARD_BootClockFRO12M(spc_core_ldo_voltage_level_t LowpowerVoltageLevel, sp
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO12M_CORE_CLOCK;
+
+    /* Let the drivers adapt to the new clock frequencies */
+    CLOCK_NotifyChange(kCLOCK_ChangeAfter);
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO24M **********************
@@ -193,6 +199,9 @@ void BOARD_BootClockFRO24M(void)
     spc_active_mode_core_ldo_option_t ldoOption;
     spc_sram_voltage_config_t sramOption;
 
+    /* Let the drivers running on the clocks being changed finish their ongoing transfers */
+    CLOCK_NotifyChange(kCLOCK_ChangeBefore);
+
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
@@ -238,6 +247,9 @@ void BOARD_BootClockFRO24M(void)
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO24M_CORE_CLOCK;
+
+    /* Let the drivers adapt to the new clock frequencies */
+    CLOCK_NotifyChange(kCLOCK_ChangeAfter);
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO48M **********************
@@ -278,6 +290,9 @@ void BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t LowpowerVoltageLevel, sp
     spc_sram_voltage_config_t sramOption;
     spc_bandgap_mode_t bandgapMode;
 
+    /* Let the drivers running on the clocks being changed finish their ongoing transfers */
+    CLOCK_NotifyChange(kCLOCK_ChangeBefore);
+
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
@@ -339,6 +354,9 @@ void BOARD_BootClockFRO48M(spc_core_ldo_voltage_level_t LowpowerVoltageLevel, sp
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO48M_CORE_CLOCK;
+
+    /* Let the drivers adapt to the new clock frequencies */
+    CLOCK_NotifyChange(kCLOCK_ChangeAfter);
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO64M **********************
@@ -382,6 +400,9 @@ void BOARD_BootClockFRO64M(void)
     spc_active_mode_core_ldo_option_t ldoOption;
     spc_sram_voltage_config_t sramOption;
 
+    /* Let the drivers running on the clocks being changed finish their ongoing transfers */
+    CLOCK_NotifyChange(kCLOCK_ChangeBefore);
+
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
@@ -427,6 +448,9 @@ void BOARD_BootClockFRO64M(void)
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO64M_CORE_CLOCK;
+
+    /* Let the drivers adapt to the new clock frequencies */
+    CLOCK_NotifyChange(kCLOCK_ChangeAfter);
 }
 /*******************************************************************************
  ******************** Configuration BOARD_BootClockFRO96M **********************
@@ -474,6 +498,9 @@ void BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t LowpowerVoltageLevel, sp
     spc_sram_voltage_config_t sramOption;
     spc_bandgap_mode_t bandgapMode;
 
+    /* Let the drivers running on the clocks being changed finish their ongoing transfers */
+    CLOCK_NotifyChange(kCLOCK_ChangeBefore);
+
     /* Get the CPU Core frequency */
     coreFreq = CLOCK_GetCoreSysClkFreq();
 
@@ -535,4 +562,7 @@ void BOARD_BootClockFRO96M(spc_core_ldo_voltage_level_t LowpowerVoltageLevel, sp
 
     /* Set SystemCoreClock variable */
     SystemCoreClock = BOARD_BOOTCLOCKFRO96M_CORE_CLOCK;
+
+    /* Let the drivers adapt to the new clock frequencies */
+    CLOCK_NotifyChange(kCLOCK_ChangeAfter);
 }
@@ -29,6 +29,21 @@
 #define LIST_EXIT_CRITICAL()  EnableGlobalIRQ(regPrimask);
 #endif
 
+static uint32_t LIST_GetHighestPriority(uint32_t readyMask)
+{
+#if (defined(SDK_COMPONENT_DEPENDENCY_FSL_COMMON) && (SDK_COMPONENT_DEPENDENCY_FSL_COMMON > 0U))
+    return 31U - (uint32_t)__CLZ(readyMask);
+#else
+    uint32_t priority = 31U;
+
+    while (0U == (readyMask & (1UL << priority)))
+    {
+        priority--;
+    }
+    return priority;
+#endif
+}
+
 static list_status_t LIST_Error_Check(list_handle_t list, list_element_handle_t newElement)
 {
     list_status_t listStatus = kLIST_Ok;
@@ -497,3 +512,237 @@ uint32_t LIST_GetAvailableSize(list_handle_t list)
 {
     return (list->max - list->size); /*Gets the number of free places in the list*/
 }
+
+/*! *********************************************************************************
+ * \brief     Links element to the list sorted by deadline.
+ *
+ * \param[in] list - ID of list to insert into.
+ *            element - deadline element to add
+ *            deadline - deadline of the element
+ *
+ * \return kLIST_Full if list is full.
+ *         kLIST_Ok if insertion was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks The tail is checked first, so an element with the latest deadline, e.g. a periodic
+ *          timer re-armed after it expired, is linked in O(1). Other elements are linked after a
+ *          scan from the head. The removal of the earliest element is O(1).
+ *
+ ********************************************************************************** */
+list_status_t LIST_AddDeadline(list_handle_t list, list_deadline_element_handle_t listElement, uint32_t deadline)
+{
+    list_element_handle_t element_Prev = NULL;
+    list_element_handle_t element_list;
+    list_status_t listStatus;
+    LIST_ENTER_CRITICAL();
+
+    listStatus = LIST_Error_Check(list, &listElement->link);
+    if (listStatus == kLIST_Ok) /* Avoiding list status error */
+    {
+        listElement->deadline = deadline;
+
+        /* Most timers are added with the latest deadline, check the tail first */
+        if ((list->size == 0U) ||
+            ((int32_t)(deadline - ((list_deadline_element_handle_t)(void *)list->tail)->deadline) >= 0))
+        {
+            element_Prev = list->tail;
+        }
+        else
+        {
+            element_list = list->head;
+            while ((int32_t)(deadline - ((list_deadline_element_handle_t)(void *)element_list)->deadline) >= 0)
+            {
+                element_Prev = element_list;
+                element_list = element_list->next;
+            }
+        }
+
+        if (element_Prev == NULL) /*Element is new head*/
+        {
+            listElement->link.next = list->head;
+            list->head             = &listElement->link;
+        }
+        else
+        {
+            listElement->link.next = element_Prev->next;
+            element_Prev->next     = &listElement->link;
+        }
+        if (listElement->link.next == NULL) /*Element is new tail*/
+        {
+            list->tail = &listElement->link;
+        }
+#if (defined(GENERIC_LIST_LIGHT) && (GENERIC_LIST_LIGHT > 0U))
+#else
+        else
+        {
+            listElement->link.next->prev = &listElement->link;
+        }
+        listElement->link.prev = element_Prev;
+#endif
+        listElement->link.list = list;
+        list->size++;
+    }
+
+    LIST_EXIT_CRITICAL();
+    return listStatus;
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks the head element of a deadline list if its deadline is reached.
+ *
+ * \param[in] list - ID of list to remove from.
+ *            now - current ticks
+ *
+ * \return NULL if list is empty or the earliest deadline is not reached.
+ *         ID of removed element(pointer) if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_deadline_element_handle_t LIST_RemoveExpired(list_handle_t list, uint32_t now)
+{
+    list_deadline_element_handle_t listElement = NULL;
+    LIST_ENTER_CRITICAL();
+
+    if ((list->size != 0U) &&
+        ((int32_t)(now - ((list_deadline_element_handle_t)(void *)list->head)->deadline) >= 0))
+    {
+        listElement = (list_deadline_element_handle_t)(void *)LIST_RemoveHead(list);
+    }
+
+    LIST_EXIT_CRITICAL();
+    return listElement;
+}
+
+/*! *********************************************************************************
+ * \brief     Initializes the priority queue descriptor.
+ *
+ * \param[in] queue - priority queue to init.
+ *
+ * \return void.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+void LIST_InitPriorityQueue(list_priority_queue_handle_t queue)
+{
+    uint32_t priority;
+
+    for (priority = 0U; priority < GENERIC_LIST_PRIORITY_COUNT; priority++)
+    {
+        LIST_Init(&queue->buckets[priority], 0U);
+    }
+    queue->readyMask = 0U;
+}
+
+/*! *********************************************************************************
+ * \brief     Links element to the tail of the list of its priority.
+ *
+ * \param[in] queue - priority queue to insert into.
+ *            element - element to add
+ *            priority - priority of the element
+ *
+ * \return kLIST_Ok if insertion was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_status_t LIST_AddPriority(list_priority_queue_handle_t queue, list_element_handle_t listElement, uint32_t priority)
+{
+    list_status_t listStatus;
+    LIST_ENTER_CRITICAL();
+
+    assert(priority < GENERIC_LIST_PRIORITY_COUNT);
+
+    listStatus = LIST_AddTail(&queue->buckets[priority], listElement);
+    if (listStatus == kLIST_Ok)
+    {
+        queue->readyMask |= (1UL << priority);
+    }
+
+    LIST_EXIT_CRITICAL();
+    return listStatus;
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks the oldest element of the highest priority.
+ *
+ * \param[in] queue - priority queue to remove from.
+ *
+ * \return NULL if queue is empty.
+ *         ID of removed element(pointer) if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_element_handle_t LIST_RemoveHighestPriority(list_priority_queue_handle_t queue)
+{
+    list_element_handle_t listElement = NULL;
+    uint32_t priority;
+    LIST_ENTER_CRITICAL();
+
+    if (queue->readyMask != 0U)
+    {
+        priority    = LIST_GetHighestPriority(queue->readyMask);
+        listElement = LIST_RemoveHead(&queue->buckets[priority]);
+        if (queue->buckets[priority].size == 0U)
+        {
+            queue->readyMask &= ~(1UL << priority);
+        }
+    }
+
+    LIST_EXIT_CRITICAL();
+    return listElement;
+}
+
+/*! *********************************************************************************
+ * \brief     Unlinks an element from a priority queue.
+ *
+ * \param[in] queue - priority queue of the element.
+ *            element - ID of the element to remove.
+ *
+ * \return kLIST_OrphanElement if element is not part of any list.
+ *         kLIST_Ok if removal was successful.
+ *
+ * \pre
+ *
+ * \post
+ *
+ * \remarks
+ *
+ ********************************************************************************** */
+list_status_t LIST_RemovePriorityElement(list_priority_queue_handle_t queue, list_element_handle_t listElement)
+{
+    list_handle_t list;
+    list_status_t listStatus;
+    LIST_ENTER_CRITICAL();
+
+    list       = listElement->list;
+    listStatus = LIST_RemoveElement(listElement);
+    if ((listStatus == kLIST_Ok) && (list->size == 0U))
+    {
+        queue->readyMask &= ~(1UL << (uint32_t)(list - &queue->buckets[0]));
+    }
+
+    LIST_EXIT_CRITICAL();
+    return listStatus;
+}
@@ -38,6 +38,11 @@
 #define GENERIC_LIST_DUPLICATED_CHECKING (0)
 #endif
 
+/*! @brief Number of priorities of a priority queue, up to 32. */
+#ifndef GENERIC_LIST_PRIORITY_COUNT
+#define GENERIC_LIST_PRIORITY_COUNT (8U)
+#endif
+
 /**********************************************************************************
  * Public type definitions
  ***********************************************************************************/
@@ -88,6 +93,20 @@ typedef struct list_element_tag
     struct list_label *list;       /*!< pointer to the list */
 } list_element_t, *list_element_handle_t;
 #endif
+
+/*! @brief The deadline queue element, the list element must be the first member */
+typedef struct list_deadline_element_tag
+{
+    list_element_t link; /*!< list element */
+    uint32_t deadline;   /*!< deadline, in free running ticks that may wrap around */
+} list_deadline_element_t, *list_deadline_element_handle_t;
+
+/*! @brief The priority queue structure, one list per priority */
+typedef struct list_priority_queue_tag
+{
+    list_label_t buckets[GENERIC_LIST_PRIORITY_COUNT]; /*!< lists of the priorities */
+    uint32_t readyMask;                                /*!< bit n is set if the list of priority n is not empty */
+} list_priority_queue_t, *list_priority_queue_handle_t;
 /**********************************************************************************
  * Public prototypes
  ***********************************************************************************/
@@ -210,6 +229,75 @@ uint32_t LIST_GetSize(list_handle_t list);
  */
 uint32_t LIST_GetAvailableSize(list_handle_t list);
 
+/*!
+ * @brief Links element to the list sorted by deadline.
+ *
+ * The element is linked after the elements with the same or an earlier deadline, so the head
+ * of the list is always the earliest deadline and is got or removed without scanning the list.
+ * Deadlines are compared as the signed difference of the two values, so the ticks may wrap
+ * around as long as the pending deadlines are less than 2^31 ticks apart.
+ *
+ * @param list - Handle of the list.
+ * @param listElement - Handle of the deadline element.
+ * @param deadline - Deadline of the element.
+ * @retval kLIST_Full if list is full, kLIST_Ok if insertion was successful.
+ */
+list_status_t LIST_AddDeadline(list_handle_t list, list_deadline_element_handle_t listElement, uint32_t deadline);
+
+/*!
+ * @brief Unlinks the head element of a deadline list if its deadline is reached.
+ *
+ * Call it in a loop to get all the expired elements.
+ *
+ * @param list - Handle of the list.
+ * @param now - Current ticks.
+ *
+ * @retval NULL if list is empty or the earliest deadline is not reached, handle of removed element otherwise.
+ */
+list_deadline_element_handle_t LIST_RemoveExpired(list_handle_t list, uint32_t now);
+
+/*!
+ * @brief Initialize the priority queue.
+ *
+ * @param queue - Priority queue handle to initialize.
+ */
+void LIST_InitPriorityQueue(list_priority_queue_handle_t queue);
+
+/*!
+ * @brief Links element to the tail of the list of its priority.
+ *
+ * Elements of the same priority are removed in insertion order.
+ *
+ * @param queue - Handle of the priority queue.
+ * @param listElement - Handle of the element.
+ * @param priority - Priority of the element, GENERIC_LIST_PRIORITY_COUNT - 1 is the highest.
+ * @retval kLIST_Ok if insertion was successful.
+ */
+list_status_t LIST_AddPriority(list_priority_queue_handle_t queue, list_element_handle_t listElement, uint32_t priority);
+
+/*!
+ * @brief Unlinks the oldest element of the highest priority.
+ *
+ * The highest non-empty priority is found by counting the leading zeros of the ready mask, so
+ * the time does not depend on the number of elements.
+ *
+ * @param queue - Handle of the priority queue.
+ *
+ * @retval NULL if queue is empty, handle of removed element otherwise.
+ */
+list_element_handle_t LIST_RemoveHighestPriority(list_priority_queue_handle_t queue);
+
+/*!
+ * @brief Unlinks an element from a priority queue.
+ *
+ * @param queue - Handle of the priority queue.
+ * @param listElement - Handle of the element.
+ *
+ * @retval kLIST_OrphanElement if element is not part of any list.
+ * @retval kLIST_Ok if removal was successful.
+ */
+list_status_t LIST_RemovePriorityElement(list_priority_queue_handle_t queue, list_element_handle_t listElement);
+
 /*! @} */
 
 #if defined(__cplusplus)
@@ -22,6 +22,9 @@
     being driven at. */
 volatile static uint32_t s_Ext_Clk_Freq = 16000000U;
 
+/* List of the registered clock change notifiers. */
+static clock_change_notifier_t *s_clockChangeNotifiers;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -1351,3 +1354,80 @@ bool CLOCK_EnableUsbfsClock(void)
 
     return true;
 }
+
+/*!
+ * brief Registers a clock change notifier.
+ *
+ * param notifier Notifier storage, it must be kept until the notifier is unregistered.
+ * param callback Callback invoked on clock change.
+ * param userData Parameter passed to the callback.
+ */
+void CLOCK_RegisterChangeNotifier(clock_change_notifier_t *notifier, clock_change_callback_t callback, void *userData)
+{
+    assert(NULL != notifier);
+    assert(NULL != callback);
+
+    clock_change_notifier_t **link = &s_clockChangeNotifiers;
+    uint32_t irqMask;
+
+    irqMask = DisableGlobalIRQ();
+
+    notifier->callback = callback;
+    notifier->userData = userData;
+
+    /* Append to the end of the list, unless it is already registered. */
+    while ((NULL != *link) && (notifier != *link))
+    {
+        link = &(*link)->next;
+    }
+    if (NULL == *link)
+    {
+        notifier->next = NULL;
+        *link          = notifier;
+    }
+
+    EnableGlobalIRQ(irqMask);
+}
+
+/*!
+ * brief Unregisters a clock change notifier.
+ *
+ * param notifier Notifier to unregister, it is ignored if it is not registered.
+ */
+void CLOCK_UnregisterChangeNotifier(clock_change_notifier_t *notifier)
+{
+    assert(NULL != notifier);
+
+    clock_change_notifier_t **link = &s_clockChangeNotifiers;
+    uint32_t irqMask;
+
+    irqMask = DisableGlobalIRQ();
+
+    while ((NULL != *link) && (notifier != *link))
+    {
+        link = &(*link)->next;
+    }
+    if (NULL != *link)
+    {
+        *link          = notifier->next;
+        notifier->next = NULL;
+    }
+
+    EnableGlobalIRQ(irqMask);
+}
+
+/*!
+ * brief Notifies the registered notifiers of a clock change.
+ *
+ * param event Clock change event.
+ */
+void CLOCK_NotifyChange(clock_change_event_t event)
+{
+    clock_change_notifier_t *notifier = s_clockChangeNotifiers;
+
+    while (NULL != notifier)
+    {
+        notifier->callback(event, notifier->userData);
+        notifier = notifier->next;
+    }
+}
@@ -663,6 +663,24 @@ typedef enum _clke_16k
     kCLKE_16K_COREMAIN = VBAT_FROCLKE_CLKE(2U)  /*!< To VDD_CORE domain. */
 } clke_16k_t;
 
+/*! @brief Clock change notification event. */
+typedef enum _clock_change_event
+{
+    kCLOCK_ChangeBefore = 0U, /*!< Clocks are about to be changed. */
+    kCLOCK_ChangeAfter  = 1U, /*!< Clocks have been changed. */
+} clock_change_event_t;
+
+/*! @brief Clock change notification callback. */
+typedef void (*clock_change_callback_t)(clock_change_event_t event, void *userData);
+
+/*! @brief Clock change notifier, the storage is provided by the subscriber. */
+typedef struct _clock_change_notifier
+{
+    struct _clock_change_notifier *next; /*!< Next notifier, used internally. */
+    clock_change_callback_t callback;    /*!< Callback invoked on clock change. */
+    void *userData;                      /*!< Parameter passed to the callback. */
+} clock_change_notifier_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -974,6 +992,37 @@ void CLOCK_SetSysOscMonitorMode(scg_sosc_monitor_mode_t mode);
  */
 bool CLOCK_EnableUsbfsClock(void);
 
+/*!
+ * @brief Registers a clock change notifier.
+ *
+ * Drivers whose functional clock can be changed at runtime register a notifier, so they can
+ * finish the ongoing transfer before the change and adapt to the new clock frequency after it.
+ * Registering a notifier that is already registered only updates its callback.
+ *
+ * @param notifier Notifier storage, it must be kept until the notifier is unregistered.
+ * @param callback Callback invoked on clock change.
+ * @param userData Parameter passed to the callback.
+ */
+void CLOCK_RegisterChangeNotifier(clock_change_notifier_t *notifier, clock_change_callback_t callback, void *userData);
+
+/*!
+ * @brief Unregisters a clock change notifier.
+ *
+ * @param notifier Notifier to unregister, it is ignored if it is not registered.
+ */
+void CLOCK_UnregisterChangeNotifier(clock_change_notifier_t *notifier);
+
+/*!
+ * @brief Notifies the registered notifiers of a clock change.
+ *
+ * Call this function with kCLOCK_ChangeBefore before changing the clock tree, and with
+ * kCLOCK_ChangeAfter when the new configuration is applied, for example at the start and at the
+ * end of the BOARD_BootClockxxx functions. Notifiers are invoked in the registration order.
+ *
+ * @param event Clock change event.
+ */
+void CLOCK_NotifyChange(clock_change_event_t event);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
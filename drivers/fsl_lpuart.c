@@ -39,6 +39,27 @@ enum
 #define LPUART_RESETS_ARRAY LPUART_RSTS
 #endif
 
+/* Address mark of the multidrop bus frames, the 9th data bit. */
+#define LPUART_MULTIDROP_ADDRESS_MARK (1U << LPUART_DATA_R8T8_SHIFT)
+
+/* Multidrop receive state. */
+enum
+{
+    kLPUART_MultidropIdle,        /*!< No multidrop receive. */
+    kLPUART_MultidropWaitAddress, /*!< Waiting for the address frame. */
+    kLPUART_MultidropWaitLength,  /*!< Waiting for the length frame. */
+    kLPUART_MultidropWaitData     /*!< Receiving the data frames. */
+};
+
+/* Baud rate kept across clock changes. */
+typedef struct _lpuart_clock_tracking
+{
+    clock_change_notifier_t notifier; /* Clock change notifier, registered while tracking is enabled. */
+    LPUART_Type *base;                /* LPUART peripheral base address. */
+    uint32_t baudRate_Bps;            /* Baud rate to keep. */
+    uint32_t srcClock_Hz;             /* Functional clock frequency the BAUD register is set for. */
+} lpuart_clock_tracking_t;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -103,6 +124,19 @@ static void LPUART_ReadNonBlocking(LPUART_Type *base, uint8_t *data, size_t leng
  * @param length Size of the buffer.
  */
 static void LPUART_ReadNonBlocking16bit(LPUART_Type *base, uint16_t *data, size_t length);
+/*!
+ * @brief Read a multidrop bus message using a blocking method.
+ *
+ * The message is a length frame followed by the data frames. An address frame restarts the message.
+ *
+ * @param base LPUART peripheral base address.
+ * @param data Start address of the buffer to store the received data.
+ * @param size Size of the buffer.
+ * @param length Returns the length of the received data stored in the buffer.
+ * @param addressed false to drop the frames until an address frame is received.
+ */
+static status_t LPUART_MultidropReadMessage(
+    LPUART_Type *base, uint8_t *data, uint8_t size, uint8_t *length, bool addressed);
 /*!
  * @brief LPUART_TransferHandleIDLEIsReady handle function.
  * This function handles when IDLE is ready.
@@ -139,6 +173,53 @@ static void LPUART_TransferHandleSendDataEmpty(LPUART_Type *base, lpuart_handle_
  */
 static void LPUART_TransferHandleTransmissionComplete(LPUART_Type *base, lpuart_handle_t *handle);
 
+/*!
+ * @brief Starts an interrupt driven receive of a multidrop message.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle LPUART handle pointer.
+ * @param data Buffer to store the message data.
+ * @param size Size of the buffer.
+ * @param length Returns the length of the received data stored in the buffer.
+ * @param addressed false to drop the frames until an address frame is received.
+ */
+static status_t LPUART_TransferMultidropReceive(
+    LPUART_Type *base, lpuart_handle_t *handle, uint8_t *data, uint8_t size, uint8_t *length, bool addressed);
+
+/*!
+ * @brief LPUART_TransferHandleMultidropReceive handle function.
+ * This function reads the received frames of a multidrop message.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle LPUART handle pointer.
+ */
+static void LPUART_TransferHandleMultidropReceive(LPUART_Type *base, lpuart_handle_t *handle);
+
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+/*!
+ * @brief Sets the RX FIFO watermark for the remaining bytes of a receive without ring buffer.
+ *
+ * One RX interrupt drains up to half of the FIFO, and never waits for more bytes than the receive
+ * still needs. The other half and the receive shift register leave the ISR time to respond before
+ * an overrun. A message ending below the watermark is drained by the idle line interrupt.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle LPUART handle pointer.
+ */
+static void LPUART_TransferUpdateRxWatermark(LPUART_Type *base, lpuart_handle_t *handle);
+#endif
+
+/*!
+ * @brief Keeps the baud rate across clock changes.
+ *
+ * Before the change, waits for the ongoing frames to finish. After the change, reprograms the
+ * BAUD register if the functional clock frequency has changed.
+ *
+ * @param event Clock change event.
+ * @param userData Clock tracking state of the LPUART instance.
+ */
+static void LPUART_ClockChangeCallback(clock_change_event_t event, void *userData);
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -180,6 +261,16 @@ lpuart_isr_t s_lpuartIsr[ARRAY_SIZE(s_lpuartBases)];
 static const reset_ip_name_t s_lpuartResets[] = LPUART_RESETS_ARRAY;
 #endif
 
+/* Clock tracking state of each LPUART instance. */
+static lpuart_clock_tracking_t s_lpuartClockTracking[ARRAY_SIZE(s_lpuartBases)];
+
+#if (defined(LPUART_BAUD_RATE_CACHE_SIZE) && (LPUART_BAUD_RATE_CACHE_SIZE > 0U))
+/* Divisors of the latest calculated clock and baud rate pairs, empty entries have zero baud rate. */
+static lpuart_baud_rate_divisor_t s_lpuartBaudRateCache[LPUART_BAUD_RATE_CACHE_SIZE];
+/* Index of the cache entry to replace next. */
+static uint32_t s_lpuartBaudRateCacheNext;
+#endif
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -245,6 +336,77 @@ size_t LPUART_TransferGetRxRingBufferLength(LPUART_Type *base, lpuart_handle_t *
     return size;
 }
 
+/*!
+ * brief Gets the received data in the RX ring buffer without copying it.
+ *
+ * param base LPUART peripheral base address.
+ * param handle LPUART handle pointer.
+ * param spans Array of two spans to be filled, unused spans are set to zero size.
+ * return Total size of the data in the spans.
+ */
+size_t LPUART_TransferPeekRxRingBuffer(LPUART_Type *base,
+                                       lpuart_handle_t *handle,
+                                       lpuart_rx_ring_buffer_span_t spans[2])
+{
+    assert(NULL != handle);
+    assert(NULL != spans);
+    assert(!handle->is16bitData);
+
+    uint32_t irqMask;
+    uint16_t tmpRxRingBufferHead;
+    uint16_t tmpRxRingBufferTail;
+
+    /* The tail is moved by the ISR when the ring buffer overruns, take both indexes at once. */
+    irqMask             = DisableGlobalIRQ();
+    tmpRxRingBufferHead = handle->rxRingBufferHead;
+    tmpRxRingBufferTail = handle->rxRingBufferTail;
+    EnableGlobalIRQ(irqMask);
+
+    spans[0].data = &handle->rxRingBuffer[tmpRxRingBufferTail];
+    spans[1].data = handle->rxRingBuffer;
+    if (tmpRxRingBufferTail > tmpRxRingBufferHead)
+    {
+        spans[0].size = handle->rxRingBufferSize - (size_t)tmpRxRingBufferTail;
+        spans[1].size = (size_t)tmpRxRingBufferHead;
+    }
+    else
+    {
+        spans[0].size = (size_t)tmpRxRingBufferHead - (size_t)tmpRxRingBufferTail;
+        spans[1].size = 0U;
+    }
+
+    return spans[0].size + spans[1].size;
+}
+
+/*!
+ * brief Releases received data in the RX ring buffer.
+ *
+ * param base LPUART peripheral base address.
+ * param handle LPUART handle pointer.
+ * param count Number of bytes to release, must not be larger than the data in the ring buffer.
+ */
+void LPUART_TransferConsumeRxRingBuffer(LPUART_Type *base, lpuart_handle_t *handle, size_t count)
+{
+    assert(NULL != handle);
+
+    uint32_t irqMask;
+    size_t tail;
+
+    irqMask = DisableGlobalIRQ();
+
+    assert(count <= LPUART_TransferGetRxRingBufferLength(base, handle));
+
+    /* Wrap to 0. Not use modulo (%) because it might be large and slow. */
+    tail = (size_t)handle->rxRingBufferTail + count;
+    if (tail >= handle->rxRingBufferSize)
+    {
+        tail -= handle->rxRingBufferSize;
+    }
+    handle->rxRingBufferTail = (uint16_t)tail;
+
+    EnableGlobalIRQ(irqMask);
+}
+
 static bool LPUART_TransferIsRxRingBufferFull(LPUART_Type *base, lpuart_handle_t *handle)
 {
     assert(NULL != handle);
@@ -333,43 +495,44 @@ static void LPUART_ReadNonBlocking16bit(LPUART_Type *base, uint16_t *data, size_
 }
 
 /*!
- * brief Initializes an LPUART instance with the user configuration structure and the peripheral clock.
+ * brief Calculates the LPUART baud rate divisor.
  *
- * This function configures the LPUART module with user-defined settings. Call the LPUART_GetDefaultConfig() function
- * to configure the configuration structure and get the default configuration.
- * The example below shows how to use this API to configure the LPUART.
- * code
- *  lpuart_config_t lpuartConfig;
- *  lpuartConfig.baudRate_Bps = 115200U;
- *  lpuartConfig.parityMode = kLPUART_ParityDisabled;
- *  lpuartConfig.dataBitsCount = kLPUART_EightDataBits;
- *  lpuartConfig.isMsb = false;
- *  lpuartConfig.stopBitCount = kLPUART_OneStopBit;
- *  lpuartConfig.txFifoWatermark = 0;
- *  lpuartConfig.rxFifoWatermark = 1;
- *  LPUART_Init(LPUART1, &lpuartConfig, 20000000U);
- * endcode
- *
- * param base LPUART peripheral base address.
- * param config Pointer to a user-defined configuration structure.
+ * param baudRate_Bps LPUART baudrate to be set.
  * param srcClock_Hz LPUART clock source frequency in HZ.
- * retval kStatus_LPUART_BaudrateNotSupport Baudrate is not support in current clock source.
- * retval kStatus_Success LPUART initialize succeed
+ * param divisor Pointer to the divisor structure to be filled.
  */
-status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t srcClock_Hz)
+void LPUART_GetBaudRateDivisor(uint32_t baudRate_Bps, uint32_t srcClock_Hz, lpuart_baud_rate_divisor_t *divisor)
 {
-    assert(NULL != config);
-    assert(0U < config->baudRate_Bps);
-#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
-    assert((uint8_t)FSL_FEATURE_LPUART_FIFO_SIZEn(base) > config->txFifoWatermark);
-    assert((uint8_t)FSL_FEATURE_LPUART_FIFO_SIZEn(base) > config->rxFifoWatermark);
-#endif
+    assert(NULL != divisor);
+    assert(0U < baudRate_Bps);
 
-    status_t status = kStatus_Success;
-    uint32_t temp;
     uint16_t sbr, sbrTemp;
     uint8_t osr, osrTemp;
-    uint32_t tempDiff, calculatedBaud, baudDiff;
+    uint32_t tempDiff, calculatedBaud, baudDiff, baud;
+#if (defined(LPUART_BAUD_RATE_CACHE_SIZE) && (LPUART_BAUD_RATE_CACHE_SIZE > 0U))
+    uint32_t irqMask;
+    uint32_t i;
+    bool found = false;
+
+    /* The same clock and baud rate pairs are set again after every clock change, look them up first. */
+    irqMask = DisableGlobalIRQ();
+    for (i = 0U; i < LPUART_BAUD_RATE_CACHE_SIZE; i++)
+    {
+        if ((s_lpuartBaudRateCache[i].baudRate_Bps == baudRate_Bps) &&
+            (s_lpuartBaudRateCache[i].srcClock_Hz == srcClock_Hz))
+        {
+            *divisor = s_lpuartBaudRateCache[i];
+            found    = true;
+            break;
+        }
+    }
+    EnableGlobalIRQ(irqMask);
+
+    if (found)
+    {
+        return;
+    }
+#endif
 
     /* This LPUART instantiation uses a slightly different baud rate calculation
      * The idea is to use the best OSR (over-sampling rate) possible
@@ -377,13 +540,14 @@ status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t
      * loop to find the best OSR value possible, one that generates minimum baudDiff
      * iterate through the rest of the supported values of OSR */
 
-    baudDiff = config->baudRate_Bps;
+    baudDiff = baudRate_Bps;
+    baud     = 0U;
     osr      = 0U;
     sbr      = 0U;
     for (osrTemp = 4U; osrTemp <= 32U; osrTemp++)
     {
         /* calculate the temporary sbr value   */
-        sbrTemp = (uint16_t)((srcClock_Hz * 2U / (config->baudRate_Bps * (uint32_t)osrTemp) + 1U) / 2U);
+        sbrTemp = (uint16_t)((srcClock_Hz * 2U / (baudRate_Bps * (uint32_t)osrTemp) + 1U) / 2U);
         /*set sbrTemp to 1 if the sourceClockInHz can not satisfy the desired baud rate*/
         if (sbrTemp == 0U)
         {
@@ -398,21 +562,80 @@ status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t
             /* Avoid MISRA 15.7 */
         }
         /* Calculate the baud rate based on the temporary OSR and SBR values */
-        calculatedBaud = (srcClock_Hz / ((uint32_t)osrTemp * (uint32_t)sbrTemp));
-        tempDiff       = calculatedBaud > config->baudRate_Bps ? (calculatedBaud - config->baudRate_Bps) :
-                                                                 (config->baudRate_Bps - calculatedBaud);
+        calculatedBaud = srcClock_Hz / ((uint32_t)osrTemp * (uint32_t)sbrTemp);
+
+        tempDiff = calculatedBaud > baudRate_Bps ? (calculatedBaud - baudRate_Bps) : (baudRate_Bps - calculatedBaud);
 
         if (tempDiff <= baudDiff)
         {
             baudDiff = tempDiff;
+            baud     = calculatedBaud;
             osr      = osrTemp; /* update and store the best OSR value calculated */
             sbr      = sbrTemp; /* update store the best SBR value calculated */
         }
     }
 
+    divisor->srcClock_Hz        = srcClock_Hz;
+    divisor->baudRate_Bps       = baudRate_Bps;
+    divisor->actualBaudRate_Bps = baud;
+    divisor->baudRateError_Bps  = baudDiff;
+    divisor->sbr                = sbr;
+    divisor->osr                = osr;
+
+#if (defined(LPUART_BAUD_RATE_CACHE_SIZE) && (LPUART_BAUD_RATE_CACHE_SIZE > 0U))
+    irqMask                                          = DisableGlobalIRQ();
+    s_lpuartBaudRateCache[s_lpuartBaudRateCacheNext] = *divisor;
+    s_lpuartBaudRateCacheNext++;
+    if (LPUART_BAUD_RATE_CACHE_SIZE <= s_lpuartBaudRateCacheNext)
+    {
+        s_lpuartBaudRateCacheNext = 0U;
+    }
+    EnableGlobalIRQ(irqMask);
+#endif
+}
+
+/*!
+ * brief Initializes an LPUART instance with the user configuration structure and the peripheral clock.
+ *
+ * This function configures the LPUART module with user-defined settings. Call the LPUART_GetDefaultConfig() function
+ * to configure the configuration structure and get the default configuration.
+ * The example below shows how to use this API to configure the LPUART.
+ * code
+ *  lpuart_config_t lpuartConfig;
+ *  lpuartConfig.baudRate_Bps = 115200U;
+ *  lpuartConfig.parityMode = kLPUART_ParityDisabled;
+ *  lpuartConfig.dataBitsCount = kLPUART_EightDataBits;
+ *  lpuartConfig.isMsb = false;
+ *  lpuartConfig.stopBitCount = kLPUART_OneStopBit;
+ *  lpuartConfig.txFifoWatermark = 0;
+ *  lpuartConfig.rxFifoWatermark = 1;
+ *  LPUART_Init(LPUART1, &lpuartConfig, 20000000U);
+ * endcode
+ *
+ * param base LPUART peripheral base address.
+ * param config Pointer to a user-defined configuration structure.
+ * param srcClock_Hz LPUART clock source frequency in HZ.
+ * retval kStatus_LPUART_BaudrateNotSupport Baudrate is not support in current clock source.
+ * retval kStatus_Success LPUART initialize succeed
+ */
+status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t srcClock_Hz)
+{
+    assert(NULL != config);
+    assert(0U < config->baudRate_Bps);
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+    assert((uint8_t)FSL_FEATURE_LPUART_FIFO_SIZEn(base) > config->txFifoWatermark);
+    assert((uint8_t)FSL_FEATURE_LPUART_FIFO_SIZEn(base) > config->rxFifoWatermark);
+#endif
+
+    status_t status = kStatus_Success;
+    uint32_t temp;
+    lpuart_baud_rate_divisor_t divisor;
+
+    LPUART_GetBaudRateDivisor(config->baudRate_Bps, srcClock_Hz, &divisor);
+
     /* Check to see if actual baud rate is within 3% of desired baud rate
      * based on the best calculate OSR value */
-    if (baudDiff > ((config->baudRate_Bps / 100U) * 3U))
+    if (divisor.baudRateError_Bps > ((config->baudRate_Bps / 100U) * 3U))
     {
         /* Unacceptable baud rate difference of more than 3%*/
         status = kStatus_LPUART_BaudrateNotSupport;
@@ -451,18 +674,18 @@ status_t LPUART_Init(LPUART_Type *base, const lpuart_config_t *config, uint32_t
          * $Branch Coverage Justification$
          * $ref fsl_lpuart_c_ref_1$
          */
-        if ((osr > 3U) && (osr < 8U))
+        if ((divisor.osr > 3U) && (divisor.osr < 8U))
         {
             temp |= LPUART_BAUD_BOTHEDGE_MASK;
         }
 
         /* program the osr value (bit value is one less than actual value) */
         temp &= ~LPUART_BAUD_OSR_MASK;
-        temp |= LPUART_BAUD_OSR((uint32_t)osr - 1UL);
+        temp |= LPUART_BAUD_OSR((uint32_t)divisor.osr - 1UL);
 
         /* write the sbr value to the BAUD registers */
         temp &= ~LPUART_BAUD_SBR_MASK;
-        base->BAUD = temp | LPUART_BAUD_SBR(sbr);
+        base->BAUD = temp | LPUART_BAUD_SBR(divisor.sbr);
 
         /* Set bit count and parity mode. */
         base->BAUD &= ~LPUART_BAUD_M10_MASK;
@@ -588,6 +811,8 @@ void LPUART_Deinit(LPUART_Type *base)
 {
     uint32_t temp;
 
+    LPUART_DisableClockChangeTracking(base);
+
 #if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
     /* Wait tx FIFO send out*/
     while (0U != ((base->WATER & LPUART_WATER_TXCOUNT_MASK) >> LPUART_WATER_TXWATER_SHIFT))
@@ -699,52 +924,13 @@ status_t LPUART_SetBaudRate(LPUART_Type *base, uint32_t baudRate_Bps, uint32_t s
 
     status_t status = kStatus_Success;
     uint32_t temp, oldCtrl;
-    uint16_t sbr, sbrTemp;
-    uint8_t osr, osrTemp;
-    uint32_t tempDiff, calculatedBaud, baudDiff;
+    lpuart_baud_rate_divisor_t divisor;
 
-    /* This LPUART instantiation uses a slightly different baud rate calculation
-     * The idea is to use the best OSR (over-sampling rate) possible
-     * Note, OSR is typically hard-set to 16 in other LPUART instantiations
-     * loop to find the best OSR value possible, one that generates minimum baudDiff
-     * iterate through the rest of the supported values of OSR */
-
-    baudDiff = baudRate_Bps;
-    osr      = 0U;
-    sbr      = 0U;
-    for (osrTemp = 4U; osrTemp <= 32U; osrTemp++)
-    {
-        /* calculate the temporary sbr value   */
-        sbrTemp = (uint16_t)((srcClock_Hz * 2U / (baudRate_Bps * (uint32_t)osrTemp) + 1U) / 2U);
-        /*set sbrTemp to 1 if the sourceClockInHz can not satisfy the desired baud rate*/
-        if (sbrTemp == 0U)
-        {
-            sbrTemp = 1U;
-        }
-        else if (sbrTemp > LPUART_BAUD_SBR_MASK)
-        {
-            sbrTemp = LPUART_BAUD_SBR_MASK;
-        }
-        else
-        {
-            /* Avoid MISRA 15.7 */
-        }
-        /* Calculate the baud rate based on the temporary OSR and SBR values */
-        calculatedBaud = srcClock_Hz / ((uint32_t)osrTemp * (uint32_t)sbrTemp);
-
-        tempDiff = calculatedBaud > baudRate_Bps ? (calculatedBaud - baudRate_Bps) : (baudRate_Bps - calculatedBaud);
-
-        if (tempDiff <= baudDiff)
-        {
-            baudDiff = tempDiff;
-            osr      = osrTemp; /* update and store the best OSR value calculated */
-            sbr      = sbrTemp; /* update store the best SBR value calculated */
-        }
-    }
+    LPUART_GetBaudRateDivisor(baudRate_Bps, srcClock_Hz, &divisor);
 
     /* Check to see if actual baud rate is within 3% of desired baud rate
      * based on the best calculate OSR value */
-    if (baudDiff < (uint32_t)((baudRate_Bps / 100U) * 3U))
+    if (divisor.baudRateError_Bps < (uint32_t)((baudRate_Bps / 100U) * 3U))
     {
         /* Store CTRL before disable Tx and Rx */
         oldCtrl = base->CTRL;
@@ -760,18 +946,18 @@ status_t LPUART_SetBaudRate(LPUART_Type *base, uint32_t baudRate_Bps, uint32_t s
          * $Branch Coverage Justification$
          * $ref fsl_lpuart_c_ref_1$
          */
-        if ((osr > 3U) && (osr < 8U))
+        if ((divisor.osr > 3U) && (divisor.osr < 8U))
         {
             temp |= LPUART_BAUD_BOTHEDGE_MASK;
         }
 
         /* program the osr value (bit value is one less than actual value) */
         temp &= ~LPUART_BAUD_OSR_MASK;
-        temp |= LPUART_BAUD_OSR((uint32_t)osr - 1UL);
+        temp |= LPUART_BAUD_OSR((uint32_t)divisor.osr - 1UL);
 
         /* write the sbr value to the BAUD registers */
         temp &= ~LPUART_BAUD_SBR_MASK;
-        base->BAUD = temp | LPUART_BAUD_SBR(sbr);
+        base->BAUD = temp | LPUART_BAUD_SBR(divisor.sbr);
 
         /* Restore CTRL. */
         base->CTRL = oldCtrl;
@@ -785,6 +971,71 @@ status_t LPUART_SetBaudRate(LPUART_Type *base, uint32_t baudRate_Bps, uint32_t s
     return status;
 }
 
+/*!
+ * brief Keeps the LPUART baud rate when the functional clock is changed.
+ *
+ * param base LPUART peripheral base address.
+ * param baudRate_Bps LPUART baudrate to keep.
+ */
+void LPUART_EnableClockChangeTracking(LPUART_Type *base, uint32_t baudRate_Bps)
+{
+    assert(0U < baudRate_Bps);
+
+    uint32_t instance                 = LPUART_GetInstance(base);
+    lpuart_clock_tracking_t *tracking = &s_lpuartClockTracking[instance];
+
+    tracking->base         = base;
+    tracking->baudRate_Bps = baudRate_Bps;
+    tracking->srcClock_Hz  = CLOCK_GetLpuartClkFreq(instance);
+    CLOCK_RegisterChangeNotifier(&tracking->notifier, LPUART_ClockChangeCallback, tracking);
+}
+
+/*!
+ * brief Stops keeping the LPUART baud rate when the functional clock is changed.
+ *
+ * param base LPUART peripheral base address.
+ */
+void LPUART_DisableClockChangeTracking(LPUART_Type *base)
+{
+    CLOCK_UnregisterChangeNotifier(&s_lpuartClockTracking[LPUART_GetInstance(base)].notifier);
+}
+
+static void LPUART_ClockChangeCallback(clock_change_event_t event, void *userData)
+{
+    lpuart_clock_tracking_t *tracking = (lpuart_clock_tracking_t *)userData;
+    LPUART_Type *base                 = tracking->base;
+    uint32_t srcClock_Hz;
+#if UART_RETRY_TIMES
+    uint32_t waitTimes;
+#endif
+
+    if (kCLOCK_ChangeBefore == event)
+    {
+        /* Let the frames being sent and received finish, no frame is cut by the clock change. */
+#if UART_RETRY_TIMES
+        waitTimes = UART_RETRY_TIMES;
+        while (((0U == (base->STAT & LPUART_STAT_TC_MASK)) || (0U != (base->STAT & LPUART_STAT_RAF_MASK))) &&
+               (0U != --waitTimes))
+#else
+        while ((0U == (base->STAT & LPUART_STAT_TC_MASK)) || (0U != (base->STAT & LPUART_STAT_RAF_MASK)))
+#endif
+        {
+        }
+    }
+    else
+    {
+        /* Only the BAUD register is updated, the FIFO content and the transfer state are kept. */
+        srcClock_Hz = CLOCK_GetLpuartClkFreq(LPUART_GetInstance(base));
+        if ((0U != srcClock_Hz) && (srcClock_Hz != tracking->srcClock_Hz))
+        {
+            if (kStatus_Success == LPUART_SetBaudRate(base, tracking->baudRate_Bps, srcClock_Hz))
+            {
+                tracking->srcClock_Hz = srcClock_Hz;
+            }
+        }
+    }
+}
+
 /*!
  * brief Enable 9-bit data mode for LPUART.
  *
@@ -836,6 +1087,32 @@ void LPUART_SendAddress(LPUART_Type *base, uint8_t address)
     base->DATA = temp;
 }
 
+/*!
+ * brief Configures the LPUART as a node of a 9-bit addressed multidrop bus.
+ *
+ * param base LPUART peripheral base address.
+ * param address Node address.
+ * param enable true to join the bus with the address, false to leave the bus and disable the 9-bit mode.
+ */
+void LPUART_EnableMultidropNode(LPUART_Type *base, uint8_t address, bool enable)
+{
+    assert(base != NULL);
+
+    if (enable)
+    {
+        LPUART_Enable9bitMode(base, true);
+        /* Match the address frames, the receiver discards the frames sent to other nodes. */
+        base->BAUD &= ~(uint32_t)LPUART_BAUD_MATCFG_MASK;
+        LPUART_SetMatchAddress(base, address, 0U);
+        LPUART_EnableMatchAddress(base, true, false);
+    }
+    else
+    {
+        LPUART_EnableMatchAddress(base, false, false);
+        LPUART_Enable9bitMode(base, false);
+    }
+}
+
 /*!
  * brief Enables LPUART interrupts according to a provided mask.
  *
@@ -1090,9 +1367,40 @@ status_t LPUART_WriteBlocking(LPUART_Type *base, const uint8_t *data, size_t len
 #if UART_RETRY_TIMES
     uint32_t waitTimes;
 #endif
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+    size_t count;
+#endif
 
     while (0U != transferSize)
     {
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+        /* Poll the TX FIFO count once and fill all the free entries, instead of polling TDRE for every byte. */
+#if UART_RETRY_TIMES
+        waitTimes = UART_RETRY_TIMES;
+#endif
+        count = (size_t)FSL_FEATURE_LPUART_FIFO_SIZEn(base) -
+                (size_t)((base->WATER & LPUART_WATER_TXCOUNT_MASK) >> LPUART_WATER_TXCOUNT_SHIFT);
+        while (0U == count)
+        {
+#if UART_RETRY_TIMES
+            if (0U == --waitTimes)
+            {
+                return kStatus_LPUART_Timeout;
+            }
+#endif
+            count = (size_t)FSL_FEATURE_LPUART_FIFO_SIZEn(base) -
+                    (size_t)((base->WATER & LPUART_WATER_TXCOUNT_MASK) >> LPUART_WATER_TXCOUNT_SHIFT);
+        }
+
+        count = MIN(count, transferSize);
+        transferSize -= count;
+        while (0U != count)
+        {
+            base->DATA = *(dataAddress);
+            dataAddress++;
+            count--;
+        }
+#else
 #if UART_RETRY_TIMES
         waitTimes = UART_RETRY_TIMES;
         while ((0U == (base->STAT & LPUART_STAT_TDRE_MASK)) && (0U != --waitTimes))
@@ -1110,6 +1418,7 @@ status_t LPUART_WriteBlocking(LPUART_Type *base, const uint8_t *data, size_t len
         base->DATA = *(dataAddress);
         dataAddress++;
         transferSize--;
+#endif /* FSL_FEATURE_LPUART_HAS_FIFO */
     }
     /* Ensure all the data in the transmit buffer are sent out to bus. */
 #if UART_RETRY_TIMES
@@ -1189,6 +1498,104 @@ status_t LPUART_WriteBlocking16bit(LPUART_Type *base, const uint16_t *data, size
     return kStatus_Success;
 }
 
+/*!
+ * brief Waits for the transmitter to finish sending, sleeping the core between events.
+ *
+ * Without a timeout, this function enables the transmission complete interrupt in the LPUART and
+ * sets SEVONPEND, so that the core waits in WFE and is woken by the pending LPUART interrupt once
+ * the last stop bit is shifted out. The LPUART interrupt is masked in the NVIC during the wait, no
+ * interrupt handler is invoked, and the NVIC and LPUART interrupt settings are restored on return.
+ * The pending interrupt is cleared and the flag checked again before each WFE: another enabled
+ * LPUART interrupt, such as RX data, keeps the interrupt pending, and SEVONPEND only signals
+ * the transition to pending, so the transmission complete event would be lost otherwise.
+ * SCB_SCR_SLEEPDEEP is cleared during the wait, so the core waits in Sleep with the LPUART clocked,
+ * and SCB->SCR is restored on return. The wait is bounded by the hardware: the transmission complete
+ * event comes once the TX FIFO and the shift register are empty, at most (TX FIFO size + 1) frames
+ * after the call.
+ *
+ * With a timeout, or if the transmitter is disabled or throttled by CTS, the flag is polled instead
+ * and the core does not sleep: the DWT cycle counter bounding the wait stops while the core sleeps,
+ * and the transmission complete event is not guaranteed without the transmitter running.
+ *
+ * param base LPUART peripheral base address.
+ * param timeoutCycles Maximum CPU cycles to poll, 0 means sleep until complete.
+ * retval kStatus_LPUART_Timeout The transmitter was still busy when the timeout expired.
+ * retval kStatus_Success All data has been sent out to the bus.
+ */
+status_t LPUART_WaitTransmitComplete(LPUART_Type *base, uint32_t timeoutCycles)
+{
+    status_t status = kStatus_Success;
+    uint32_t startCycles;
+#if defined(FSL_FEATURE_LPUART_HAS_SEPARATE_RX_TX_IRQ) && FSL_FEATURE_LPUART_HAS_SEPARATE_RX_TX_IRQ
+    IRQn_Type irq = s_lpuartTxIRQ[LPUART_GetInstance(base)];
+#else
+    IRQn_Type irq = s_lpuartIRQ[LPUART_GetInstance(base)];
+#endif
+    uint32_t irqEnabled;
+    uint32_t scr;
+    bool eventWait;
+
+    if (0U != (base->STAT & LPUART_STAT_TC_MASK))
+    {
+        return kStatus_Success;
+    }
+
+    /* The transmission complete event only comes when the transmitter can drain on its own. */
+    eventWait = (0U == timeoutCycles) && (0U != (base->CTRL & LPUART_CTRL_TE_MASK));
+#if defined(FSL_FEATURE_LPUART_HAS_MODEM_SUPPORT) && FSL_FEATURE_LPUART_HAS_MODEM_SUPPORT
+    eventWait = eventWait && (0U == (base->MODIR & LPUART_MODIR_TXCTSE_MASK));
+#endif
+
+    if (eventWait)
+    {
+        irqEnabled = NVIC_GetEnableIRQ(irq);
+        NVIC_DisableIRQ(irq);
+        /* Wait in Sleep, not in whatever low power mode SLEEPDEEP was left selecting. */
+        scr      = SCB->SCR;
+        SCB->SCR = (scr | SCB_SCR_SEVONPEND_Msk) & ~SCB_SCR_SLEEPDEEP_Msk;
+        base->CTRL |= LPUART_CTRL_TCIE_MASK;
+
+        while (true)
+        {
+            /*
+             * Clear the pending interrupt first, then check the flag: if it is still not set, the
+             * interrupt becomes pending again when it sets, which is the event ending the WFE. A
+             * level still asserted by another source pends again at once and the WFE returns.
+             */
+            NVIC_ClearPendingIRQ(irq);
+            if (0U != (base->STAT & LPUART_STAT_TC_MASK))
+            {
+                break;
+            }
+            /* A stale event makes the first WFE return at once, the loop checks the flag again. */
+            __WFE();
+        }
+
+        base->CTRL &= ~LPUART_CTRL_TCIE_MASK;
+        SCB->SCR = scr;
+        NVIC_ClearPendingIRQ(irq);
+        if (0U != irqEnabled)
+        {
+            NVIC_EnableIRQ(irq);
+        }
+    }
+    else
+    {
+        MSDK_EnableCpuCycleCounter();
+        startCycles = MSDK_GetCpuCycleCount();
+        while (0U == (base->STAT & LPUART_STAT_TC_MASK))
+        {
+            if ((0U != timeoutCycles) && ((MSDK_GetCpuCycleCount() - startCycles) >= timeoutCycles))
+            {
+                status = kStatus_LPUART_Timeout;
+                break;
+            }
+        }
+    }
+
+    return status;
+}
+
 /*!
  * brief Reads the receiver data register using a blocking method.
  *
@@ -1212,6 +1619,7 @@ status_t LPUART_ReadBlocking(LPUART_Type *base, uint8_t *data, size_t length)
     status_t status = kStatus_Success;
     uint32_t statusFlag;
     uint8_t *dataAddress = data;
+    size_t count;
 
 #if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
     uint32_t ctrl        = base->CTRL;
@@ -1223,7 +1631,7 @@ status_t LPUART_ReadBlocking(LPUART_Type *base, uint8_t *data, size_t length)
     uint32_t waitTimes;
 #endif
 
-    while (0U != (length--))
+    while (0U != length)
     {
 #if UART_RETRY_TIMES
         waitTimes = UART_RETRY_TIMES;
@@ -1297,21 +1705,33 @@ status_t LPUART_ReadBlocking(LPUART_Type *base, uint8_t *data, size_t length)
 
         if (kStatus_Success == status)
         {
-#if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
-            if (isSevenDataBits)
-            {
-                *(dataAddress) = (uint8_t)(base->DATA & 0x7FU);
-                dataAddress++;
-            }
-            else
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+            /* Read all the data already in the RX FIFO, instead of polling RXCOUNT for every byte. */
+            count = (size_t)((base->WATER & LPUART_WATER_RXCOUNT_MASK) >> LPUART_WATER_RXCOUNT_SHIFT);
+            count = MIN(count, length);
+#else
+            count = 1U;
+#endif
+            length -= count;
+            while (0U != count)
             {
+#if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
+                if (isSevenDataBits)
+                {
+                    *(dataAddress) = (uint8_t)(base->DATA & 0x7FU);
+                    dataAddress++;
+                }
+                else
+                {
+                    *(dataAddress) = (uint8_t)base->DATA;
+                    dataAddress++;
+                }
+#else
                 *(dataAddress) = (uint8_t)base->DATA;
                 dataAddress++;
-            }
-#else
-            *(dataAddress) = (uint8_t)base->DATA;
-            dataAddress++;
 #endif
+                count--;
+            }
         }
         else
         {
@@ -1433,6 +1853,160 @@ status_t LPUART_ReadBlocking16bit(LPUART_Type *base, uint16_t *data, size_t leng
     return status;
 }
 
+static status_t LPUART_MultidropReadMessage(
+    LPUART_Type *base, uint8_t *data, uint8_t size, uint8_t *length, bool addressed)
+{
+    status_t status;
+    uint16_t frame;
+    uint8_t expected    = 0U;
+    uint8_t received    = 0U;
+    bool isAddressed    = addressed;
+    bool lengthReceived = false;
+
+    do
+    {
+        status = LPUART_ReadBlocking16bit(base, &frame, 1U);
+        if (kStatus_Success != status)
+        {
+            break;
+        }
+
+        if (0U != (frame & LPUART_MULTIDROP_ADDRESS_MARK))
+        {
+            /* The master (re)started a message, drop the data received so far. */
+            isAddressed    = true;
+            lengthReceived = false;
+            received       = 0U;
+        }
+        else if (!isAddressed)
+        {
+            /* Data of a message already in progress when the wait started. */
+        }
+        else if (!lengthReceived)
+        {
+            expected       = (uint8_t)frame;
+            lengthReceived = true;
+        }
+        else
+        {
+            if (received < size)
+            {
+                data[received] = (uint8_t)frame;
+            }
+            received++;
+        }
+    } while ((!lengthReceived) || (received < expected));
+
+    if (kStatus_Success == status)
+    {
+        *length = MIN(expected, size);
+        if (expected > size)
+        {
+            status = kStatus_OutOfRange;
+        }
+    }
+
+    return status;
+}
+
+/*!
+ * brief Sends a request to a node of the multidrop bus using a blocking method.
+ *
+ * param base LPUART peripheral base address, the master LPUART in 9-bit mode.
+ * param address Node address.
+ * param data Request data, can be NULL if length is 0.
+ * param length Request data length.
+ * retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * retval kStatus_Success Successfully sent the request.
+ */
+status_t LPUART_MultidropSendRequest(LPUART_Type *base, uint8_t address, const uint8_t *data, uint8_t length)
+{
+    assert((NULL != data) || (0U == length));
+
+    uint16_t header[2];
+    status_t status;
+
+    header[0] = (uint16_t)address | (uint16_t)LPUART_MULTIDROP_ADDRESS_MARK;
+    header[1] = (uint16_t)length;
+
+    status = LPUART_WriteBlocking16bit(base, header, ARRAY_SIZE(header));
+    if ((kStatus_Success == status) && (0U != length))
+    {
+        status = LPUART_WriteBlocking(base, data, length);
+    }
+
+    return status;
+}
+
+/*!
+ * brief Receives a request sent to this node of the multidrop bus using a blocking method.
+ *
+ * param base LPUART peripheral base address, configured by LPUART_EnableMultidropNode.
+ * param data Buffer to store the request data.
+ * param size Size of the buffer.
+ * param length Returns the length of the received data stored in the buffer.
+ * retval kStatus_OutOfRange The request is longer than the buffer, the remaining data are dropped.
+ * retval kStatus_LPUART_RxHardwareOverrun Receiver overrun happened while receiving data.
+ * retval kStatus_LPUART_NoiseError Noise error happened while receiving data.
+ * retval kStatus_LPUART_FramingError Framing error happened while receiving data.
+ * retval kStatus_LPUART_ParityError Parity error happened while receiving data.
+ * retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * retval kStatus_Success Successfully received the request.
+ */
+status_t LPUART_MultidropReceiveRequest(LPUART_Type *base, uint8_t *data, uint8_t size, uint8_t *length)
+{
+    assert((NULL != data) && (NULL != length));
+
+    /* The request starts with the matched address frame. */
+    return LPUART_MultidropReadMessage(base, data, size, length, false);
+}
+
+/*!
+ * brief Sends the response to the master of the multidrop bus using a blocking method.
+ *
+ * param base LPUART peripheral base address, configured by LPUART_EnableMultidropNode.
+ * param data Response data, can be NULL if length is 0.
+ * param length Response data length.
+ * retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * retval kStatus_Success Successfully sent the response.
+ */
+status_t LPUART_MultidropSendResponse(LPUART_Type *base, const uint8_t *data, uint8_t length)
+{
+    assert((NULL != data) || (0U == length));
+
+    status_t status;
+
+    status = LPUART_WriteBlocking(base, &length, 1U);
+    if ((kStatus_Success == status) && (0U != length))
+    {
+        status = LPUART_WriteBlocking(base, data, length);
+    }
+
+    return status;
+}
+
+/*!
+ * brief Receives the response of the addressed node of the multidrop bus using a blocking method.
+ *
+ * param base LPUART peripheral base address, the master LPUART in 9-bit mode.
+ * param data Buffer to store the response data.
+ * param size Size of the buffer.
+ * param length Returns the length of the received data stored in the buffer.
+ * retval kStatus_OutOfRange The response is longer than the buffer, the remaining data are dropped.
+ * retval kStatus_LPUART_RxHardwareOverrun Receiver overrun happened while receiving data.
+ * retval kStatus_LPUART_NoiseError Noise error happened while receiving data.
+ * retval kStatus_LPUART_FramingError Framing error happened while receiving data.
+ * retval kStatus_LPUART_ParityError Parity error happened while receiving data.
+ * retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * retval kStatus_Success Successfully received the response.
+ */
+status_t LPUART_MultidropReceiveResponse(LPUART_Type *base, uint8_t *data, uint8_t size, uint8_t *length)
+{
+    assert((NULL != data) && (NULL != length));
+
+    return LPUART_MultidropReadMessage(base, data, size, length, true);
+}
+
 /*!
  * brief Initializes the LPUART handle.
  *
@@ -1579,6 +2153,8 @@ void LPUART_TransferStopRingBuffer(LPUART_Type *base, lpuart_handle_t *handle)
  * returns directly without waiting for all data written to the transmitter register. When
  * all data is written to the TX register in the ISR, the LPUART driver calls the callback
  * function and passes the ref kStatus_LPUART_TxIdle as status parameter.
+ * On FIFO parts, the free FIFO entries are filled before this function returns, the ISR
+ * refills the FIFO each time it drains to the TX watermark.
  *
  * note The kStatus_LPUART_TxIdle is passed to the upper layer when all data are written
  * to the TX register. However, there is no check to ensure that all the data sent out. Before disabling the TX,
@@ -1619,11 +2195,20 @@ status_t LPUART_TransferSendNonBlocking(LPUART_Type *base, lpuart_handle_t *hand
         handle->txDataSizeAll = xfer->dataSize;
         handle->txState       = (uint8_t)kLPUART_TxBusy;
 
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+        /* Fill the free FIFO entries now, the TX interrupt only refills what is left each time the FIFO drains
+           to the TX watermark. A transfer that fits in the FIFO only takes the transmission complete interrupt. */
+        LPUART_TransferHandleSendDataEmpty(base, handle);
+#endif
+
         /* Disable and re-enable the global interrupt to protect the interrupt enable register during read-modify-wrte.
          */
         uint32_t irqMask = DisableGlobalIRQ();
-        /* Enable transmitter interrupt. */
-        base->CTRL |= (uint32_t)LPUART_CTRL_TIE_MASK;
+        if (0U != handle->txDataSize)
+        {
+            /* Enable transmitter interrupt. */
+            base->CTRL |= (uint32_t)LPUART_CTRL_TIE_MASK;
+        }
         EnableGlobalIRQ(irqMask);
 
         status = kStatus_Success;
@@ -1715,6 +2300,9 @@ status_t LPUART_TransferGetSendCount(LPUART_Type *base, lpuart_handle_t *handle,
  * saved from xfer->data[5]. When 5 bytes are received, the LPUART driver notifies the upper layer.
  * If the RX ring buffer is not enabled, this function enables the RX and RX interrupt
  * to receive data to xfer->data. When all data is received, the upper layer is notified.
+ * On FIFO parts, the RX watermark is raised during such a receive so that one interrupt
+ * drains up to half of the FIFO, the idle line interrupt drains the bytes below the watermark.
+ * The watermark set by the application is restored when the receive ends or is aborted.
  *
  * param base LPUART peripheral base address.
  * param handle LPUART handle pointer.
@@ -1859,6 +2447,12 @@ status_t LPUART_TransferReceiveNonBlocking(LPUART_Type *base,
             /* Disable and re-enable the global interrupt to protect the interrupt enable register during
              * read-modify-wrte. */
             irqMask = DisableGlobalIRQ();
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+            /* Interrupt once per FIFO batch instead of once per byte. */
+            handle->rxFifoWatermark =
+                (uint8_t)((base->WATER & LPUART_WATER_RXWATER_MASK) >> LPUART_WATER_RXWATER_SHIFT);
+            LPUART_TransferUpdateRxWatermark(base, handle);
+#endif
             /* Enable RX interrupt. */
             base->CTRL |= (uint32_t)(LPUART_CTRL_RIE_MASK | LPUART_CTRL_ILIE_MASK | LPUART_CTRL_ORIE_MASK);
             EnableGlobalIRQ(irqMask);
@@ -1897,11 +2491,21 @@ void LPUART_TransferAbortReceive(LPUART_Type *base, lpuart_handle_t *handle)
         uint32_t irqMask = DisableGlobalIRQ();
         /* Disable RX interrupt. */
         base->CTRL &= ~(uint32_t)(LPUART_CTRL_RIE_MASK | LPUART_CTRL_ILIE_MASK | LPUART_CTRL_ORIE_MASK);
+#if defined(FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING) && FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING
+        base->CTRL &= ~(uint32_t)LPUART_CTRL_MA1IE_MASK;
+#endif
         EnableGlobalIRQ(irqMask);
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+        if (((uint8_t)kLPUART_RxBusy == handle->rxState) && ((uint8_t)kLPUART_MultidropIdle == handle->multidropState))
+        {
+            LPUART_SetRxFifoWatermark(base, handle->rxFifoWatermark);
+        }
+#endif
     }
 
-    handle->rxDataSize = 0U;
-    handle->rxState    = (uint8_t)kLPUART_RxIdle;
+    handle->rxDataSize     = 0U;
+    handle->multidropState = (uint8_t)kLPUART_MultidropIdle;
+    handle->rxState        = (uint8_t)kLPUART_RxIdle;
 }
 
 /*!
@@ -1936,6 +2540,206 @@ status_t LPUART_TransferGetReceiveCount(LPUART_Type *base, lpuart_handle_t *hand
     return status;
 }
 
+static status_t LPUART_TransferMultidropReceive(
+    LPUART_Type *base, lpuart_handle_t *handle, uint8_t *data, uint8_t size, uint8_t *length, bool addressed)
+{
+    assert(NULL != handle);
+    assert((NULL != data) && (NULL != length));
+    /* The ring buffer would take the received frames. */
+    assert(NULL == handle->rxRingBuffer);
+
+    status_t status;
+    uint32_t irqMask;
+
+    if ((uint8_t)kLPUART_RxBusy == handle->rxState)
+    {
+        status = kStatus_LPUART_RxBusy;
+    }
+    else
+    {
+        handle->rxData            = data;
+        handle->rxDataSize        = size;
+        handle->rxDataSizeAll     = size;
+        handle->multidropLength   = length;
+        handle->multidropExpected = 0U;
+        handle->multidropReceived = 0U;
+        handle->multidropState    = (uint8_t)(addressed ? kLPUART_MultidropWaitLength : kLPUART_MultidropWaitAddress);
+        handle->rxState           = (uint8_t)kLPUART_RxBusy;
+
+        /* Disable and re-enable the global interrupt to protect the interrupt enable register during
+         * read-modify-wrte. */
+        irqMask = DisableGlobalIRQ();
+#if defined(FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING) && FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING
+        if (!addressed)
+        {
+            /* Only the address frame of a request to this node raises the first interrupt. */
+            base->STAT = ((base->STAT & 0x3FE00000U) | LPUART_STAT_MA1F_MASK);
+            base->CTRL |= (uint32_t)LPUART_CTRL_MA1IE_MASK;
+        }
+        else
+#endif
+        {
+            base->CTRL |= (uint32_t)(LPUART_CTRL_RIE_MASK | LPUART_CTRL_ORIE_MASK);
+        }
+        EnableGlobalIRQ(irqMask);
+
+        status = kStatus_Success;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Receives a request sent to this node of the multidrop bus using an interrupt method.
+ *
+ * param base LPUART peripheral base address, configured by LPUART_EnableMultidropNode.
+ * param handle LPUART handle pointer.
+ * param data Buffer to store the request data.
+ * param size Size of the buffer.
+ * param length Returns the length of the received data stored in the buffer, set before the callback.
+ * retval kStatus_Success Successfully started waiting for the request.
+ * retval kStatus_LPUART_RxBusy Previous receive request is not finished.
+ */
+status_t LPUART_TransferMultidropReceiveRequest(
+    LPUART_Type *base, lpuart_handle_t *handle, uint8_t *data, uint8_t size, uint8_t *length)
+{
+    /* The request starts with the matched address frame. */
+    return LPUART_TransferMultidropReceive(base, handle, data, size, length, false);
+}
+
+/*!
+ * brief Receives the response of the addressed node of the multidrop bus using an interrupt method.
+ *
+ * param base LPUART peripheral base address, the master LPUART in 9-bit mode.
+ * param handle LPUART handle pointer.
+ * param data Buffer to store the response data.
+ * param size Size of the buffer.
+ * param length Returns the length of the received data stored in the buffer, set before the callback.
+ * retval kStatus_Success Successfully started waiting for the response.
+ * retval kStatus_LPUART_RxBusy Previous receive request is not finished.
+ */
+status_t LPUART_TransferMultidropReceiveResponse(
+    LPUART_Type *base, lpuart_handle_t *handle, uint8_t *data, uint8_t size, uint8_t *length)
+{
+    return LPUART_TransferMultidropReceive(base, handle, data, size, length, true);
+}
+
+static void LPUART_TransferHandleMultidropReceive(LPUART_Type *base, lpuart_handle_t *handle)
+{
+    status_t status = kStatus_Success;
+    bool complete   = false;
+    uint32_t irqMask;
+    uint32_t frame;
+
+#if defined(FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING) && FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING
+    /* Clear the address match, the address frame is read below. */
+    base->STAT = ((base->STAT & 0x3FE00000U) | LPUART_STAT_MA1F_MASK);
+#endif
+
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+    while ((!complete) && (0U != (base->WATER & LPUART_WATER_RXCOUNT_MASK)))
+#else
+    while ((!complete) && (0U != (base->STAT & LPUART_STAT_RDRF_MASK)))
+#endif
+    {
+        /* The error bits of DATA belong to the frame read with them. */
+        frame = base->DATA;
+        if (0U != (frame & LPUART_DATA_NOISY_MASK))
+        {
+            status = kStatus_LPUART_NoiseError;
+        }
+        else if (0U != (frame & LPUART_DATA_PARITYE_MASK))
+        {
+            status = kStatus_LPUART_ParityError;
+        }
+        else if (0U != (frame & LPUART_DATA_FRETSC_MASK))
+        {
+            status = kStatus_LPUART_FramingError;
+        }
+        else if (0U != (frame & LPUART_MULTIDROP_ADDRESS_MARK))
+        {
+            /* The master (re)started a message, drop the data received so far. */
+            handle->multidropState    = (uint8_t)kLPUART_MultidropWaitLength;
+            handle->multidropReceived = 0U;
+            handle->rxDataSize        = handle->rxDataSizeAll;
+
+            /* Receive the rest of the message by the receive interrupt. */
+            irqMask = DisableGlobalIRQ();
+#if defined(FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING) && FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING
+            base->CTRL &= ~(uint32_t)LPUART_CTRL_MA1IE_MASK;
+#endif
+            base->CTRL |= (uint32_t)(LPUART_CTRL_RIE_MASK | LPUART_CTRL_ORIE_MASK);
+            EnableGlobalIRQ(irqMask);
+        }
+        else if ((uint8_t)kLPUART_MultidropWaitAddress == handle->multidropState)
+        {
+            /* Data of a message already in progress when the receive started. */
+        }
+        else if ((uint8_t)kLPUART_MultidropWaitLength == handle->multidropState)
+        {
+            handle->multidropExpected = (uint8_t)frame;
+            handle->multidropState    = (uint8_t)kLPUART_MultidropWaitData;
+        }
+        else
+        {
+            if (0U != handle->rxDataSize)
+            {
+                handle->rxData[handle->multidropReceived] = (uint8_t)frame;
+                handle->rxDataSize--;
+            }
+            handle->multidropReceived++;
+        }
+
+        complete = (kStatus_Success != status) ||
+                   (((uint8_t)kLPUART_MultidropWaitData == handle->multidropState) &&
+                    (handle->multidropReceived >= handle->multidropExpected));
+    }
+
+    if (complete)
+    {
+        irqMask = DisableGlobalIRQ();
+        base->CTRL &= ~(uint32_t)(LPUART_CTRL_RIE_MASK | LPUART_CTRL_ORIE_MASK);
+        EnableGlobalIRQ(irqMask);
+
+        if (kStatus_Success != status)
+        {
+            /* Clear the error flags of the dropped frame. */
+            base->STAT = ((base->STAT & 0x3FE00000U) | LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK | LPUART_STAT_PF_MASK);
+        }
+        else
+        {
+            *handle->multidropLength = MIN(handle->multidropExpected, (uint8_t)handle->rxDataSizeAll);
+            status = (handle->multidropExpected > handle->rxDataSizeAll) ? kStatus_OutOfRange : kStatus_LPUART_RxIdle;
+        }
+
+        handle->multidropState = (uint8_t)kLPUART_MultidropIdle;
+        handle->rxDataSize     = 0U;
+        handle->rxState        = (uint8_t)kLPUART_RxIdle;
+
+        if (NULL != handle->callback)
+        {
+            handle->callback(base, handle, status, handle->userData);
+        }
+    }
+}
+
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+static void LPUART_TransferUpdateRxWatermark(LPUART_Type *base, lpuart_handle_t *handle)
+{
+    size_t batch = MIN(handle->rxDataSize, (size_t)FSL_FEATURE_LPUART_FIFO_SIZEn(base) / 2U);
+
+    if (0U != batch)
+    {
+        LPUART_SetRxFifoWatermark(base, (uint8_t)(batch - 1U));
+    }
+    else
+    {
+        /* The receive has ended, restore the watermark of the application. */
+        LPUART_SetRxFifoWatermark(base, handle->rxFifoWatermark);
+    }
+}
+#endif
+
 static void LPUART_TransferHandleIDLEReady(LPUART_Type *base, lpuart_handle_t *handle)
 {
     uint32_t irqMask;
@@ -1965,6 +2769,10 @@ static void LPUART_TransferHandleIDLEReady(LPUART_Type *base, lpuart_handle_t *h
         if (0U == (handle->rxDataSize))
         {
             handle->rxState = (uint8_t)kLPUART_RxIdle;
+            if (NULL == handle->rxRingBuffer)
+            {
+                LPUART_TransferUpdateRxWatermark(base, handle);
+            }
 
             if (NULL != handle->callback)
             {
@@ -1972,12 +2780,24 @@ static void LPUART_TransferHandleIDLEReady(LPUART_Type *base, lpuart_handle_t *h
             }
         }
     }
+
+    if ((NULL == handle->rxRingBuffer) && (0U != handle->rxDataSize))
+    {
+        LPUART_TransferUpdateRxWatermark(base, handle);
+    }
+#endif
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+    /* In ring buffer mode, move the data left in the FIFO to the ring buffer before reporting the idle line. */
+    if ((NULL != handle->rxRingBuffer) && (0U != count))
+    {
+        LPUART_TransferHandleReceiveDataFull(base, handle);
+    }
 #endif
     /* Clear IDLE flag.*/
     base->STAT = ((base->STAT & 0x3FE00000U) | LPUART_STAT_IDLE_MASK);
 
-    /* If rxDataSize is 0, disable rx ready, overrun and idle line interrupt.*/
-    if (0U == handle->rxDataSize)
+    /* If rxDataSize is 0 and ring buffer is not used, disable rx ready, overrun and idle line interrupt.*/
+    if ((0U == handle->rxDataSize) && (NULL == handle->rxRingBuffer))
     {
         /* Disable and re-enable the global interrupt to protect the interrupt enable register during
          * read-modify-wrte. */
@@ -1985,7 +2805,7 @@ static void LPUART_TransferHandleIDLEReady(LPUART_Type *base, lpuart_handle_t *h
         base->CTRL &= ~(uint32_t)(LPUART_CTRL_RIE_MASK | LPUART_CTRL_ILIE_MASK | LPUART_CTRL_ORIE_MASK);
         EnableGlobalIRQ(irqMask);
     }
-    /* Invoke callback if callback is not NULL and rxDataSize is not 0. */
+    /* Invoke callback if callback is not NULL and rxDataSize is not 0 or ring buffer is used. */
     else if (NULL != handle->callback)
     {
         handle->callback(base, handle, kStatus_LPUART_IdleLineDetected, handle->userData);
@@ -2038,6 +2858,12 @@ static void LPUART_TransferHandleReceiveDataFull(LPUART_Type *base, lpuart_handl
         if (0U == handle->rxDataSize)
         {
             handle->rxState = (uint8_t)kLPUART_RxIdle;
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+            if (NULL == handle->rxRingBuffer)
+            {
+                LPUART_TransferUpdateRxWatermark(base, handle);
+            }
+#endif
 
             if (NULL != handle->callback)
             {
@@ -2126,8 +2952,12 @@ static void LPUART_TransferHandleReceiveDataFull(LPUART_Type *base, lpuart_handl
     }
     else
     {
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+        /* Wait for the next batch of the receive. */
+        LPUART_TransferUpdateRxWatermark(base, handle);
+#else
         /* Avoid MISRA C-2012 15.7 voiation */
-        return;
+#endif
     }
 }
 
@@ -2235,12 +3065,30 @@ void LPUART_TransferHandleIRQ(LPUART_Type *base, void *irqHandle)
     {
         LPUART_TransferHandleIDLEReady(base, handle);
     }
+    /* Multidrop message, started by the address match or continued by the receive data register full. */
+    if ((uint8_t)kLPUART_MultidropIdle != handle->multidropState)
+    {
+        if (((0U != ((uint32_t)kLPUART_RxDataRegFullFlag & status)) &&
+             (0U != ((uint32_t)kLPUART_RxDataRegFullInterruptEnable & enabledInterrupts)))
+#if defined(FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING) && FSL_FEATURE_LPUART_HAS_ADDRESS_MATCHING
+            || ((0U != ((uint32_t)kLPUART_DataMatch1Flag & status)) &&
+                (0U != ((uint32_t)kLPUART_Match1InterruptEnable & enabledInterrupts)))
+#endif
+        )
+        {
+            LPUART_TransferHandleMultidropReceive(base, handle);
+        }
+    }
     /* Receive data register full */
-    if ((0U != ((uint32_t)kLPUART_RxDataRegFullFlag & status)) &&
-        (0U != ((uint32_t)kLPUART_RxDataRegFullInterruptEnable & enabledInterrupts)))
+    else if ((0U != ((uint32_t)kLPUART_RxDataRegFullFlag & status)) &&
+             (0U != ((uint32_t)kLPUART_RxDataRegFullInterruptEnable & enabledInterrupts)))
     {
         LPUART_TransferHandleReceiveDataFull(base, handle);
     }
+    else
+    {
+        /* Avoid MISRA 15.7 */
+    }
 
     /* Send data register empty and the interrupt is enabled. */
     if ((0U != ((uint32_t)kLPUART_TxDataRegEmptyFlag & status)) &&
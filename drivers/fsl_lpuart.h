@@ -30,6 +30,11 @@
 #define UART_RETRY_TIMES 0U /* Defining to zero means to keep waiting for the flag until it is assert/deassert. */
 #endif
 
+/*! @brief Number of source clock and baud rate pairs whose divisors are cached, 0 disables the cache. */
+#ifndef LPUART_BAUD_RATE_CACHE_SIZE
+#define LPUART_BAUD_RATE_CACHE_SIZE 2U
+#endif
+
 /*! @brief Error codes for the LPUART driver. */
 enum
 {
@@ -262,6 +267,17 @@ typedef struct _lpuart_config
     bool enableRx;                            /*!< Enable RX */
 } lpuart_config_t;
 
+/*! @brief LPUART baud rate divisor. */
+typedef struct _lpuart_baud_rate_divisor
+{
+    uint32_t srcClock_Hz;        /*!< LPUART clock source frequency in HZ. */
+    uint32_t baudRate_Bps;       /*!< Requested baud rate. */
+    uint32_t actualBaudRate_Bps; /*!< Baud rate generated by osr and sbr. */
+    uint32_t baudRateError_Bps;  /*!< Difference between the requested and the generated baud rate. */
+    uint16_t sbr;                /*!< Baud rate modulo divisor. */
+    uint8_t osr;                 /*!< Oversampling ratio, 4 to 32. */
+} lpuart_baud_rate_divisor_t;
+
 /*! @brief LPUART transfer structure. */
 typedef struct _lpuart_transfer
 {
@@ -280,6 +296,13 @@ typedef struct _lpuart_transfer
     size_t dataSize;              /*!< The byte count to be transfer. */
 } lpuart_transfer_t;
 
+/*! @brief Contiguous part of the received data in the RX ring buffer. */
+typedef struct _lpuart_rx_ring_buffer_span
+{
+    uint8_t *data; /*!< Start address of the data, points into the RX ring buffer. */
+    size_t size;   /*!< Size of the data. */
+} lpuart_rx_ring_buffer_span_t;
+
 /* Forward declaration of the handle typedef. */
 typedef struct _lpuart_handle lpuart_handle_t;
 
@@ -318,6 +341,14 @@ struct _lpuart_handle
 
     volatile uint8_t txState;            /*!< TX transfer state. */
     volatile uint8_t rxState;            /*!< RX transfer state. */
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+    uint8_t rxFifoWatermark;             /*!< RX FIFO watermark restored when a receive without ring buffer ends. */
+#endif
+
+    uint8_t *multidropLength;         /*!< Returns the length of the multidrop message received to rxData. */
+    uint8_t multidropExpected;        /*!< Length of the multidrop message in progress. */
+    uint8_t multidropReceived;        /*!< Data frames of the multidrop message received so far. */
+    volatile uint8_t multidropState;  /*!< Multidrop receive state, idle unless a multidrop receive is started. */
 
 #if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
     bool isSevenDataBits; /*!< Seven data bits flag. */
@@ -458,6 +489,41 @@ void LPUART_GetDefaultConfig(lpuart_config_t *config);
  */
 status_t LPUART_SetBaudRate(LPUART_Type *base, uint32_t baudRate_Bps, uint32_t srcClock_Hz);
 
+/*!
+ * @brief Calculates the LPUART baud rate divisor.
+ *
+ * This function finds the OSR and SBR values that generate the baud rate closest to the requested one,
+ * it is used by LPUART_Init and LPUART_SetBaudRate. The latest results are kept in a cache of
+ * LPUART_BAUD_RATE_CACHE_SIZE entries, so setting a clock and baud rate pair again, for example after
+ * every clock change, does not repeat the search. Use this function to check the baud rate error
+ * before changing the clock.
+ *
+ * @param baudRate_Bps LPUART baudrate to be set.
+ * @param srcClock_Hz LPUART clock source frequency in HZ.
+ * @param divisor Pointer to the divisor structure to be filled.
+ */
+void LPUART_GetBaudRateDivisor(uint32_t baudRate_Bps, uint32_t srcClock_Hz, lpuart_baud_rate_divisor_t *divisor);
+
+/*!
+ * @brief Keeps the LPUART baud rate when the functional clock is changed.
+ *
+ * This function registers the LPUART to the clock change notifications of the clock driver.
+ * Before a clock change, it waits for the frames being sent and received to finish. After the
+ * change, only the BAUD register is reprogrammed if the functional clock frequency has changed,
+ * the LPUART stays initialized and the transfers continue. LPUART_Deinit stops the tracking.
+ *
+ * @param base LPUART peripheral base address.
+ * @param baudRate_Bps LPUART baudrate to keep.
+ */
+void LPUART_EnableClockChangeTracking(LPUART_Type *base, uint32_t baudRate_Bps);
+
+/*!
+ * @brief Stops keeping the LPUART baud rate when the functional clock is changed.
+ *
+ * @param base LPUART peripheral base address.
+ */
+void LPUART_DisableClockChangeTracking(LPUART_Type *base);
+
 /*!
  * @brief Enable 9-bit data mode for LPUART.
  *
@@ -521,6 +587,23 @@ static inline void LPUART_EnableMatchAddress(LPUART_Type *base, bool match1, boo
     }
 }
 
+/*!
+ * @brief Configures the LPUART as a node of a 9-bit addressed multidrop bus.
+ *
+ * This function enables the 9-bit data mode and the match address1 filter with the node address.
+ * The receiver then discards every frame until an address frame with the node address is received,
+ * and discards again once the master addresses another node. The discarded frames do not set any
+ * flag, so a node waiting for a request in low power mode with the receive interrupt enabled is only
+ * woken up by the requests sent to it.
+ *
+ * The master only needs @ref LPUART_Enable9bitMode, it does not filter the received frames.
+ *
+ * @param base LPUART peripheral base address.
+ * @param address Node address.
+ * @param enable true to join the bus with the address, false to leave the bus and disable the 9-bit mode.
+ */
+void LPUART_EnableMultidropNode(LPUART_Type *base, uint8_t address, bool enable);
+
 #if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
 /*!
  * @brief Sets the rx FIFO watermark.
@@ -867,6 +950,7 @@ void LPUART_SendAddress(LPUART_Type *base, uint8_t address);
  *
  * This function polls the transmitter register, first waits for the register to be empty or TX FIFO to have room,
  * and writes data to the transmitter buffer, then waits for the dat to be sent out to the bus.
+ * When the TX FIFO is available, all of its free entries are filled after each poll.
  *
  * @param base LPUART peripheral base address.
  * @param data Start address of the data to write.
@@ -890,11 +974,36 @@ status_t LPUART_WriteBlocking(LPUART_Type *base, const uint8_t *data, size_t len
  */
 status_t LPUART_WriteBlocking16bit(LPUART_Type *base, const uint16_t *data, size_t length);
 
+/*!
+ * @brief Waits for the transmitter to finish sending, sleeping the core between events.
+ *
+ * Without a timeout, this function enables the transmission complete interrupt in the LPUART and
+ * sets SEVONPEND, so that the core waits in WFE and is woken by the pending LPUART interrupt once
+ * the last stop bit is shifted out. The LPUART interrupt is masked in the NVIC during the wait, no
+ * interrupt handler is invoked, and the NVIC and LPUART interrupt settings are restored on return.
+ * The pending interrupt is cleared before each WFE, so another enabled LPUART interrupt, such as
+ * RX data, cannot hide the transmission complete event. SCB_SCR_SLEEPDEEP is cleared during the
+ * wait, so the core waits in Sleep with the LPUART clocked, and SCB->SCR is restored on return.
+ *
+ * @note Without a timeout the wait is bounded by the hardware: the transmission complete event
+ * comes once the TX FIFO and the shift register are empty, at most (TX FIFO size + 1) frames after
+ * the call, as long as the LPUART functional clock runs in Sleep. With a timeout, or if the
+ * transmitter is disabled or throttled by CTS, the flag is polled and the core does not sleep, since
+ * the DWT cycle counter bounding the wait stops while the core sleeps.
+ *
+ * @param base LPUART peripheral base address.
+ * @param timeoutCycles Maximum CPU cycles to poll, 0 means sleep until complete.
+ * @retval kStatus_LPUART_Timeout The transmitter was still busy when the timeout expired.
+ * @retval kStatus_Success All data has been sent out to the bus.
+ */
+status_t LPUART_WaitTransmitComplete(LPUART_Type *base, uint32_t timeoutCycles);
+
 /*!
  * @brief Reads the receiver data register using a blocking method.
  *
  * This function polls the receiver register, waits for the receiver register full or receiver FIFO
- * has data, and reads data from the TX register.
+ * has data, and reads data from the TX register. When the RX FIFO is available, all the data
+ * in it are read after each poll.
  *
  * @param base LPUART peripheral base address.
  * @param data Start address of the buffer to store the received data.
@@ -925,6 +1034,75 @@ status_t LPUART_ReadBlocking(LPUART_Type *base, uint8_t *data, size_t length);
  */
 status_t LPUART_ReadBlocking16bit(LPUART_Type *base, uint16_t *data, size_t length);
 
+/*!
+ * @brief Sends a request to a node of the multidrop bus using a blocking method.
+ *
+ * The request is an address frame with the node address, followed by a length frame and the request
+ * data frames. Sending the address frame un-addresses the node of the previous request, so only the
+ * addressed node receives the request and the response it sends back.
+ *
+ * @param base LPUART peripheral base address, the master LPUART in 9-bit mode.
+ * @param address Node address.
+ * @param data Request data, can be NULL if length is 0.
+ * @param length Request data length.
+ * @retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * @retval kStatus_Success Successfully sent the request.
+ */
+status_t LPUART_MultidropSendRequest(LPUART_Type *base, uint8_t address, const uint8_t *data, uint8_t length);
+
+/*!
+ * @brief Receives a request sent to this node of the multidrop bus using a blocking method.
+ *
+ * If the master sends a new request to this node before the previous one is complete, the previous
+ * request is dropped and the new one is received.
+ *
+ * @param base LPUART peripheral base address, configured by @ref LPUART_EnableMultidropNode.
+ * @param data Buffer to store the request data.
+ * @param size Size of the buffer.
+ * @param length Returns the length of the received data stored in the buffer.
+ * @retval kStatus_OutOfRange The request is longer than the buffer, the remaining data are dropped.
+ * @retval kStatus_LPUART_RxHardwareOverrun Receiver overrun happened while receiving data.
+ * @retval kStatus_LPUART_NoiseError Noise error happened while receiving data.
+ * @retval kStatus_LPUART_FramingError Framing error happened while receiving data.
+ * @retval kStatus_LPUART_ParityError Parity error happened while receiving data.
+ * @retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * @retval kStatus_Success Successfully received the request.
+ */
+status_t LPUART_MultidropReceiveRequest(LPUART_Type *base, uint8_t *data, uint8_t size, uint8_t *length);
+
+/*!
+ * @brief Sends the response to the master of the multidrop bus using a blocking method.
+ *
+ * The response is a length frame followed by the response data frames.
+ *
+ * @note On a single wire bus the node also receives its own response. The node discards it only if
+ * the receiver is disabled while responding.
+ *
+ * @param base LPUART peripheral base address, configured by @ref LPUART_EnableMultidropNode.
+ * @param data Response data, can be NULL if length is 0.
+ * @param length Response data length.
+ * @retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * @retval kStatus_Success Successfully sent the response.
+ */
+status_t LPUART_MultidropSendResponse(LPUART_Type *base, const uint8_t *data, uint8_t length);
+
+/*!
+ * @brief Receives the response of the addressed node of the multidrop bus using a blocking method.
+ *
+ * @param base LPUART peripheral base address, the master LPUART in 9-bit mode.
+ * @param data Buffer to store the response data.
+ * @param size Size of the buffer.
+ * @param length Returns the length of the received data stored in the buffer.
+ * @retval kStatus_OutOfRange The response is longer than the buffer, the remaining data are dropped.
+ * @retval kStatus_LPUART_RxHardwareOverrun Receiver overrun happened while receiving data.
+ * @retval kStatus_LPUART_NoiseError Noise error happened while receiving data.
+ * @retval kStatus_LPUART_FramingError Framing error happened while receiving data.
+ * @retval kStatus_LPUART_ParityError Parity error happened while receiving data.
+ * @retval kStatus_LPUART_Timeout Transmission timed out and was aborted.
+ * @retval kStatus_Success Successfully received the response.
+ */
+status_t LPUART_MultidropReceiveResponse(LPUART_Type *base, uint8_t *data, uint8_t size, uint8_t *length);
+
 /*! @} */
 
 /*!
@@ -961,6 +1139,8 @@ void LPUART_TransferCreateHandle(LPUART_Type *base,
  * returns directly without waiting for all data written to the transmitter register. When
  * all data is written to the TX register in the ISR, the LPUART driver calls the callback
  * function and passes the @ref kStatus_LPUART_TxIdle as status parameter.
+ * On FIFO parts, the free FIFO entries are filled before this function returns, the ISR
+ * refills the FIFO each time it drains to the TX watermark.
  *
  * @note The kStatus_LPUART_TxIdle is passed to the upper layer when all data are written
  * to the TX register. However, there is no check to ensure that all the data sent out. Before disabling the TX,
@@ -987,6 +1167,9 @@ status_t LPUART_TransferSendNonBlocking(LPUART_Type *base, lpuart_handle_t *hand
  * @note When using RX ring buffer, one byte is reserved for internal use. In other
  * words, if @p ringBufferSize is 32, then only 31 bytes are used for saving data.
  *
+ * @note If the idle line interrupt is enabled, the callback is invoked with kStatus_LPUART_IdleLineDetected
+ * at the end of each receive burst, after the data is stored into the ring buffer.
+ *
  * @param base LPUART peripheral base address.
  * @param handle LPUART handle pointer.
  * @param ringBuffer Start address of ring buffer for background receiving. Pass NULL to disable the ring buffer.
@@ -1016,6 +1199,38 @@ void LPUART_TransferStopRingBuffer(LPUART_Type *base, lpuart_handle_t *handle);
  */
 size_t LPUART_TransferGetRxRingBufferLength(LPUART_Type *base, lpuart_handle_t *handle);
 
+/*!
+ * @brief Gets the received data in the RX ring buffer without copying it.
+ *
+ * The received data is returned as up to two spans pointing into the RX ring buffer, the second
+ * span is used when the data wraps around the end of the ring buffer. The data stays in the ring
+ * buffer until it is released by LPUART_TransferConsumeRxRingBuffer, so it can be parsed in place.
+ *
+ * @note Only 8-bit data is supported. If the ring buffer gets full while the spans are in use,
+ * the driver overwrites the oldest data and reports kStatus_LPUART_RxRingBufferOverrun through
+ * the callback, the spans are no longer valid in this case.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle LPUART handle pointer.
+ * @param spans Array of two spans to be filled, unused spans are set to zero size.
+ * @return Total size of the data in the spans.
+ */
+size_t LPUART_TransferPeekRxRingBuffer(LPUART_Type *base,
+                                       lpuart_handle_t *handle,
+                                       lpuart_rx_ring_buffer_span_t spans[2]);
+
+/*!
+ * @brief Releases received data in the RX ring buffer.
+ *
+ * This function removes the oldest @p count bytes from the RX ring buffer, it is used to release
+ * the data got by LPUART_TransferPeekRxRingBuffer.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle LPUART handle pointer.
+ * @param count Number of bytes to release, must not be larger than the data in the ring buffer.
+ */
+void LPUART_TransferConsumeRxRingBuffer(LPUART_Type *base, lpuart_handle_t *handle, size_t count);
+
 /*!
  * @brief Aborts the interrupt-driven data transmit.
  *
@@ -1058,6 +1273,9 @@ status_t LPUART_TransferGetSendCount(LPUART_Type *base, lpuart_handle_t *handle,
  * saved from xfer->data[5]. When 5 bytes are received, the LPUART driver notifies the upper layer.
  * If the RX ring buffer is not enabled, this function enables the RX and RX interrupt
  * to receive data to xfer->data. When all data is received, the upper layer is notified.
+ * On FIFO parts, the RX watermark is raised during such a receive so that one interrupt
+ * drains up to half of the FIFO, the idle line interrupt drains the bytes below the watermark.
+ * The watermark set by the application is restored when the receive ends or is aborted.
  *
  * @param base LPUART peripheral base address.
  * @param handle LPUART handle pointer.
@@ -1097,6 +1315,65 @@ void LPUART_TransferAbortReceive(LPUART_Type *base, lpuart_handle_t *handle);
  */
 status_t LPUART_TransferGetReceiveCount(LPUART_Type *base, lpuart_handle_t *handle, uint32_t *count);
 
+/*!
+ * @brief Receives a request sent to this node of the multidrop bus using an interrupt method.
+ *
+ * This is the non-blocking version of @ref LPUART_MultidropReceiveRequest. Only the match address1
+ * interrupt is enabled while waiting, the receiver discards the frames sent to other nodes without
+ * setting any flag. The first interrupt is the address frame of a request to this node, the driver
+ * then enables the receive interrupt for the rest of the message. In the meantime the core can wait
+ * in Sleep or DeepSleep. In DeepSleep, the LPUART functional clock and its MRCC clock gate must be
+ * kept running. When the request is complete, the callback is invoked with
+ * @ref kStatus_LPUART_RxIdle, or kStatus_OutOfRange if the request is longer than the buffer. A
+ * noise, framing or parity error ends the receive, and its status is passed to the callback.
+ *
+ * @code
+ *   static volatile bool s_requestDone;
+ *
+ *   static void NODE_Callback(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData)
+ *   {
+ *       s_requestDone = true;
+ *   }
+ *
+ *   LPUART_EnableMultidropNode(LPUART1, NODE_ADDRESS, true);
+ *   LPUART_TransferCreateHandle(LPUART1, &g_nodeHandle, NODE_Callback, NULL);
+ *   LPUART_TransferMultidropReceiveRequest(LPUART1, &g_nodeHandle, request, sizeof(request), &length);
+ *   while (!s_requestDone)
+ *   {
+ *       __WFI();
+ *   }
+ * @endcode
+ *
+ * @note The RX ring buffer must not be used with the multidrop receive.
+ *
+ * @param base LPUART peripheral base address, configured by @ref LPUART_EnableMultidropNode.
+ * @param handle LPUART handle pointer.
+ * @param data Buffer to store the request data.
+ * @param size Size of the buffer.
+ * @param length Returns the length of the received data stored in the buffer, set before the callback.
+ * @retval kStatus_Success Successfully started waiting for the request.
+ * @retval kStatus_LPUART_RxBusy Previous receive request is not finished.
+ */
+status_t LPUART_TransferMultidropReceiveRequest(
+    LPUART_Type *base, lpuart_handle_t *handle, uint8_t *data, uint8_t size, uint8_t *length);
+
+/*!
+ * @brief Receives the response of the addressed node of the multidrop bus using an interrupt method.
+ *
+ * This is the non-blocking version of @ref LPUART_MultidropReceiveResponse. The callback is invoked
+ * with the same status as @ref LPUART_TransferMultidropReceiveRequest.
+ *
+ * @param base LPUART peripheral base address, the master LPUART in 9-bit mode.
+ * @param handle LPUART handle pointer.
+ * @param data Buffer to store the response data.
+ * @param size Size of the buffer.
+ * @param length Returns the length of the received data stored in the buffer, set before the callback.
+ * @retval kStatus_Success Successfully started waiting for the response.
+ * @retval kStatus_LPUART_RxBusy Previous receive request is not finished.
+ */
+status_t LPUART_TransferMultidropReceiveResponse(
+    LPUART_Type *base, lpuart_handle_t *handle, uint8_t *data, uint8_t size, uint8_t *length);
+
 /*!
  * @brief LPUART IRQ handle function.
  *
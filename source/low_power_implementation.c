@@ -17,6 +17,13 @@
 #include "fsl_wuu.h"
 #include "fsl_gpio.h"
 #include "fsl_port.h"
+#include "fsl_retained_trace.h"
+#include "fsl_boot_profile.h"
+#include "fsl_retained_data.h"
+#include "fsl_ram_footprint.h"
+#include "fsl_spsc_queue.h"
+#include "fsl_pin_park.h"
+#include "fsl_timer_service.h"
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
@@ -46,7 +53,11 @@
 #define APP_WUU_IRQN        			WUU0_IRQn
 #define APP_WUU_IRQ_HANDLER 			WUU0_IRQHandler
 #define APP_WUU_WAKEUP_BUTTON_NAME      "SW2"
+#define APP_WUU_WAKEUP_BUTTON_PORT_IDX  1U
+#define APP_WUU_WAKEUP_BUTTON_PIN       BOARD_SW2_GPIO_PIN
 
+/* PORT instance index of the debug console pins. */
+#define APP_DEBUG_CONSOLE_PORT_IDX  	0U
 /* LPUART RX */
 #define APP_DEBUG_CONSOLE_RX_PORT   	PORT0
 #define APP_DEBUG_CONSOLE_RX_GPIO   	GPIO0
@@ -57,6 +68,75 @@
 #define APP_DEBUG_CONSOLE_TX_GPIO   	GPIO0
 #define APP_DEBUG_CONSOLE_TX_PIN    	3U
 #define APP_DEBUG_CONSOLE_TX_PINMUX 	kPORT_MuxAlt2
+/* LPUART clock gate, kept on in DeepSleep when the debug console is a wakeup source. */
+#define APP_DEBUG_CONSOLE_MRCC_MASK 	MRCC_MRCC_GLB_CC0_LPUART0_MASK
+/* Debug console input can only wake up the device when it is received by interrupt. */
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+#define APP_DEBUG_CONSOLE_WAKEUP_ENABLE 1U
+#else
+#define APP_DEBUG_CONSOLE_WAKEUP_ENABLE 0U
+#endif
+/* Log module tags */
+#define APP_LOG_MENU  0U /* Menus and user input. */
+#define APP_LOG_POWER 1U /* Power mode transitions. */
+#define APP_LOG_TRACE 2U /* Trace records of the previous run. */
+#define APP_LOG_BOOT  3U /* Boot profile. */
+/* Menu key to print the boot profile. */
+#define APP_BOOT_PROFILE_KEY 'P'
+/* Menu key to print the RAM footprint. */
+#define APP_RAM_FOOTPRINT_KEY 'R'
+/* Menu key to stay in DeepSleep or PowerDown woken up by the timer service. */
+#define APP_TIMER_DEMO_KEY 'T'
+/* Timer service demo: a periodic timer, and a slower one whose slack lets it share the wakeups of the first. */
+#define APP_TIMER_DEMO_PERIOD_MS      1000U
+#define APP_TIMER_DEMO_SLOW_PERIOD_MS 3000U
+#define APP_TIMER_DEMO_SLOW_DELAY_MS  2900U
+#define APP_TIMER_DEMO_SLOW_SLACK_MS  250U
+/* Callbacks of the periodic timer before the demo returns to the menu. */
+#define APP_TIMER_DEMO_CALLBACKS 6U
+/* Number of events the interrupt handlers can post before the main loop handles them, a power of two. */
+#define APP_EVENT_QUEUE_SIZE 8U
+/* Event word posted to the main loop, the type in the upper byte and the argument below. */
+#define APP_EVENT(type, value) (((uint32_t)(type) << 24U) | ((uint32_t)(value) & 0x00FFFFFFU))
+#define APP_EVENT_TYPE(event)  ((event) >> 24U)
+#define APP_EVENT_VALUE(event) ((event) & 0x00FFFFFFU)
+/* Bits of one debug console frame: start, 8 data and stop bit. */
+#define APP_DEBUG_CONSOLE_FRAME_BITS 10U
+
+/* Retained trace events, the value of each record is given in the comment. */
+typedef enum _app_trace_event
+{
+    kAPP_TraceBoot = 0U,      /* CMC system reset status. */
+    kAPP_TraceEnterPowerMode, /* Target power mode. */
+    kAPP_TraceExitPowerMode,  /* Target power mode. */
+    kAPP_TraceEventCount
+} app_trace_event_t;
+
+/* Events posted by the interrupt handlers, the argument of each event is given in the comment. */
+typedef enum _app_event
+{
+    kAPP_EventWakeupPin = 0U, /* WUU external wakeup pin flags. */
+    kAPP_EventCount
+} app_event_t;
+
+#define APP_TRACE_EVENT_NAME                      \
+    {                                             \
+        "Boot", "EnterPowerMode", "ExitPowerMode" \
+    }
+
+/* Timer of the timer service demo, counting its callbacks. */
+typedef struct _app_demo_timer
+{
+    timer_service_timer_t timer;
+    volatile uint32_t callbacks;
+} app_demo_timer_t;
+
+/* Application state kept across DeepPowerDown when RAMX0/X1 is retained. */
+typedef struct _app_retained_state
+{
+    retained_data_header_t header;
+    uint32_t wakeupCount; /* DeepPowerDown wakeups since the state was lost. */
+} app_retained_state_t;
 
 
 /*******************************************************************************
@@ -89,12 +169,53 @@ static void APP_SetSIRC(void);
 static void APP_SetRAMRetention(app_power_mode_t targetPowerMode);
 static void APP_DisVoltageDetect(void);
 static void APP_EnVoltageDetect(void);
+static void APP_FlushTrace(void);
+static void APP_PrintBootProfile(void);
+static void APP_PrintRamFootprint(void);
+static void APP_RestoreRetainedState(void);
+static void APP_HandleEvents(void);
+static void APP_TimerDemoCallback(void *param);
+static void APP_RunTimerDemo(app_power_mode_t targetPowerMode);
+static void APP_PrintTimerDemo(void);
 /*******************************************************************************
  * Variables
  ******************************************************************************/
 
 char *const g_modeNameArray[] = APP_POWER_MODE_NAME;
 char *const g_modeDescArray[] = APP_POWER_MODE_DESC;
+char *const g_traceEventNameArray[] = APP_TRACE_EVENT_NAME;
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+char *const g_bootPhaseNameArray[] = BOOT_PROFILE_PHASE_NAME;
+#endif
+
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_DEBUG)
+/*
+ * Debug console drain before the last low power entry: the characters still to send and the time the core
+ * was awake, in microseconds. The cycle counter stops while the core sleeps, so the time asleep is not in it.
+ */
+static uint32_t s_consoleDrainChars;
+static uint32_t s_consoleDrainActiveUs;
+/* Pins parked before the last low power entry. */
+static uint32_t s_parkedPinCount;
+#endif
+
+static app_retained_state_t s_appRetainedState RETAINED_DATA_RAMX;
+
+/* Events from the interrupt handlers to the main loop, pushed and popped without masking interrupts. */
+static uint32_t s_appEventBuffer[APP_EVENT_QUEUE_SIZE];
+static spsc_queue_t s_appEventQueue;
+
+#if (APP_DEBUG_CONSOLE_WAKEUP_ENABLE > 0U)
+/* Keep the debug console running in DeepSleep, its RX interrupt wakes up the device. */
+static bool s_consoleWakeup;
+#endif
+
+/* The timer service demo is selected, its timers and the wakeup count when it started. */
+static bool s_timerDemo;
+static app_power_mode_t s_timerDemoMode;
+static app_demo_timer_t s_timerDemoFast;
+static app_demo_timer_t s_timerDemoSlow;
+static uint32_t s_timerDemoWakeupBase;
 
 /*******************************************************************************
  * Code
@@ -106,7 +227,6 @@ void APP_InitDebugConsole(void)
      * Debug console TX pin: Don't need to change.
      */
     BOARD_InitPins();
-    BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
     BOARD_InitDebugConsole();
 }
 
@@ -120,13 +240,15 @@ void APP_DeinitDebugConsole(void)
 
 int main(void)
 {
-    uint32_t freq;
     app_power_mode_t targetPowerMode;
     bool needSetWakeup = false;
 
     BOARD_InitPins();
+    BootProfile_Mark(kBOOT_PROFILE_InitPins);
     BOARD_InitBootClocks();
+    BootProfile_Mark(kBOOT_PROFILE_InitBootClocks);
     BOARD_InitDebugConsole();
+    BootProfile_Mark(kBOOT_PROFILE_InitDebugConsole);
 
     /* Release the I/O pads and certain peripherals to normal run mode state, for in Power Down mode
      * they will be in a latched state. */
@@ -135,14 +257,33 @@ int main(void)
         SPC_ClearPeriphIOIsolationFlag(APP_SPC);
     }
 
+    /* Dump what the previous run recorded before a reset or a DeepPowerDown wakeup, then trace this boot. */
+    APP_FlushTrace();
+    RetainedTrace_Record((uint16_t)kAPP_TraceBoot, CMC_GetSystemResetStatus(APP_CMC));
+    APP_RestoreRetainedState();
+    (void)SpscQueue_Init(&s_appEventQueue, s_appEventBuffer, APP_EVENT_QUEUE_SIZE);
+
+    /* Every other pin is parked in low power modes: the debug console pins are handled by
+     * APP_DeinitDebugConsole, and the wakeup button must keep its input buffer. */
+    PinPark_Init();
+    PinPark_ClaimPins(APP_DEBUG_CONSOLE_PORT_IDX,
+                      (1UL << APP_DEBUG_CONSOLE_RX_PIN) | (1UL << APP_DEBUG_CONSOLE_TX_PIN));
+    PinPark_ClaimPins(APP_WUU_WAKEUP_BUTTON_PORT_IDX, 1UL << APP_WUU_WAKEUP_BUTTON_PIN);
+
     APP_SetVBATConfiguration();
     APP_SetSPCConfiguration();
+    BootProfile_Mark(kBOOT_PROFILE_PowerConfiguration);
+
+    /* The LPTMR of the timer service counts clk_16k, enabled by APP_SetVBATConfiguration. */
+    TimerService_Init();
+    TimerService_InitTimer(&s_timerDemoFast.timer, APP_TimerDemoCallback, &s_timerDemoFast);
+    TimerService_InitTimer(&s_timerDemoSlow.timer, APP_TimerDemoCallback, &s_timerDemoSlow);
 
     /* clear wake up related flag for Deep Power Down */
     WUU0->PF|= WUU_PF_WUF9_MASK;
     NVIC_ClearPendingIRQ(WUU0_IRQn);
 
-    PRINTF("\r\nNormal Boot.\r\n");
+    DBG_LOG_DEBUG(APP_LOG_POWER, "\r\nNormal Boot.\r\n");
 
     while (1)
     {
@@ -159,10 +300,9 @@ int main(void)
         /* Normal start. */
         APP_SetCMCConfiguration();
 
-        freq = CLOCK_GetFreq(kCLOCK_CoreSysClk);
-        PRINTF("\r\n###########################    Power Mode Switch Demo    ###########################\r\n");
-        PRINTF("    Core Clock = %dHz \r\n", freq);
-        PRINTF("    Power mode: Active\r\n");
+        DBG_LOG_INFO(APP_LOG_MENU, "\r\n###########################    Power Mode Switch Demo    ###########################\r\n");
+        DBG_LOG_INFO(APP_LOG_MENU, "    Core Clock = %dHz \r\n", CLOCK_GetFreq(kCLOCK_CoreSysClk));
+        DBG_LOG_INFO(APP_LOG_MENU, "    Power mode: Active\r\n");
         targetPowerMode = APP_GetTargetPowerMode();
 
         if ((targetPowerMode > kAPP_PowerModeMin) && (targetPowerMode < kAPP_PowerModeMax))
@@ -179,17 +319,31 @@ int main(void)
         }
 
         /* Print description of selected power mode. */
-        PRINTF("\r\n");
+        DBG_LOG_INFO(APP_LOG_MENU, "\r\n");
         if (needSetWakeup)
         {
             APP_GetWakeupConfig(targetPowerMode);
             APP_SetTargetPowerMode(targetPowerMode);
             APP_PowerPreSwitchHook();
-            APP_PowerModeSwitch(targetPowerMode);
+            RetainedTrace_Record((uint16_t)kAPP_TraceEnterPowerMode, (uint32_t)targetPowerMode);
+            if (s_timerDemo)
+            {
+                APP_RunTimerDemo(targetPowerMode);
+            }
+            else
+            {
+                APP_PowerModeSwitch(targetPowerMode);
+            }
+            RetainedTrace_Record((uint16_t)kAPP_TraceExitPowerMode, (uint32_t)targetPowerMode);
             APP_PowerPostSwitchHook();
+            APP_HandleEvents();
+            if (s_timerDemo)
+            {
+                APP_PrintTimerDemo();
+            }
         }
 
-        PRINTF("\r\nNext loop.\r\n");
+        DBG_LOG_DEBUG(APP_LOG_POWER, "\r\nNext loop.\r\n");
     }
 }
 
@@ -219,7 +373,7 @@ static void APP_SetSPCConfiguration(void)
 #endif
     if (status != kStatus_Success)
     {
-        PRINTF("Fail to set regulators in Active mode.");
+        DBG_LOG_ERROR(APP_LOG_POWER, "Fail to set regulators in Active mode.");
         return;
     }
     while (SPC_GetBusyStatusFlag(APP_SPC))
@@ -241,7 +395,7 @@ static void APP_SetSPCConfiguration(void)
 #endif
     if (status != kStatus_Success)
     {
-        PRINTF("Fail to set regulators in Low Power Mode.");
+        DBG_LOG_ERROR(APP_LOG_POWER, "Fail to set regulators in Low Power Mode.");
         return;
     }
     while (SPC_GetBusyStatusFlag(APP_SPC))
@@ -283,16 +437,25 @@ static app_power_mode_t APP_GetTargetPowerMode(void)
 
     app_power_mode_t inputPowerMode;
 
+    s_timerDemo = false;
+
     do
     {
-        PRINTF("\r\nSelect the desired operation \n\r\n");
+        DBG_LOG_INFO(APP_LOG_MENU, "\r\nSelect the desired operation \n\r\n");
         for (app_power_mode_t modeIndex = kAPP_PowerModeActive; modeIndex <= kAPP_PowerModeDeepPowerDown; modeIndex++)
         {
-            PRINTF("\tPress %c to enter: %s mode\r\n", modeIndex,
+            DBG_LOG_INFO(APP_LOG_MENU, "\tPress %c to enter: %s mode\r\n", modeIndex,
                    g_modeNameArray[(uint8_t)(modeIndex - kAPP_PowerModeActive)]);
         }
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+        DBG_LOG_INFO(APP_LOG_MENU, "\tPress %c to print the boot profile\r\n", APP_BOOT_PROFILE_KEY);
+#endif
+        DBG_LOG_INFO(APP_LOG_MENU, "\tPress %c to print the RAM footprint\r\n", APP_RAM_FOOTPRINT_KEY);
+        DBG_LOG_INFO(APP_LOG_MENU,
+                     "\tPress %c to enter: DeepSleep or PowerDown mode, woken up by the timer service\r\n",
+                     APP_TIMER_DEMO_KEY);
 
-        PRINTF("\r\nWaiting for power mode select...\r\n\r\n");
+        DBG_LOG_INFO(APP_LOG_MENU, "\r\nWaiting for power mode select...\r\n\r\n");
 
         ch = GETCHAR();
 
@@ -302,13 +465,42 @@ static app_power_mode_t APP_GetTargetPowerMode(void)
         }
         inputPowerMode = (app_power_mode_t)ch;
 
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+        if (APP_BOOT_PROFILE_KEY == ch)
+        {
+            APP_PrintBootProfile();
+            continue;
+        }
+#endif
+        if (APP_RAM_FOOTPRINT_KEY == ch)
+        {
+            APP_PrintRamFootprint();
+            continue;
+        }
+        if (APP_TIMER_DEMO_KEY == ch)
+        {
+            /* In PowerDown, the LPTMR wakes up the device through its WUU internal module. */
+            DBG_LOG_INFO(APP_LOG_MENU, "\tPress %c for DeepSleep or %c for PowerDown\r\n", kAPP_PowerModeDeepSleep,
+                         kAPP_PowerModePowerDown);
+            ch = GETCHAR();
+            if ((ch >= 'a') && (ch <= 'z'))
+            {
+                ch -= 'a' - 'A';
+            }
+            inputPowerMode =
+                ((uint8_t)kAPP_PowerModePowerDown == ch) ? kAPP_PowerModePowerDown : kAPP_PowerModeDeepSleep;
+            DBG_LOG_INFO(APP_LOG_MENU, "\tTimer service: wake up every %u ms, %u times, or press %s to stop.\r\n",
+                         APP_TIMER_DEMO_PERIOD_MS, APP_TIMER_DEMO_CALLBACKS, APP_WUU_WAKEUP_BUTTON_NAME);
+            s_timerDemo     = true;
+            s_timerDemoMode = inputPowerMode;
+        }
         if ((inputPowerMode > kAPP_PowerModeDeepPowerDown) || (inputPowerMode < kAPP_PowerModeActive))
         {
-            PRINTF("Wrong Input!");
+            DBG_LOG_WARN(APP_LOG_MENU, "Wrong Input!");
         }
     } while (inputPowerMode > kAPP_PowerModeDeepPowerDown);
 
-    PRINTF("\t%s\r\n", g_modeDescArray[(uint8_t)(inputPowerMode - kAPP_PowerModeActive)]);
+    DBG_LOG_INFO(APP_LOG_MENU, "\t%s\r\n", g_modeDescArray[(uint8_t)(inputPowerMode - kAPP_PowerModeActive)]);
 
     return inputPowerMode;
 }
@@ -338,8 +530,8 @@ static void APP_SetTargetPowerMode(app_power_mode_t targetPowerMode)
 static void APP_SetSleepMode(app_power_mode_t targetPowerMode)
 {
 	APP_SetCoreFreqAndLDO(targetPowerMode);
-	PRINTF("\r\nEntering Sleep mode...\r\n");
-	PRINTF("Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
+	DBG_LOG_INFO(APP_LOG_POWER, "\r\nEntering Sleep mode...\r\n");
+	DBG_LOG_INFO(APP_LOG_POWER, "Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
     SCG0->FIRCCSR &= ~SCG_FIRCCSR_LK_MASK;
     SCG0->FIRCCSR &= ~SCG_FIRCCSR_FIRC_SCLK_PERIPH_EN_MASK;
     SCG0->FIRCCSR &= ~SCG_FIRCCSR_FIRC_FCLK_PERIPH_EN_MASK;
@@ -354,24 +546,30 @@ static void APP_SetDeepSleepMode(app_power_mode_t targetPowerMode)
 {
 	APP_SetCoreFreqAndLDO(targetPowerMode);
 	APP_SetSIRC();
-	PRINTF("\r\nEntering DeepSleep mode...\r\n");
-	PRINTF("Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
+	DBG_LOG_INFO(APP_LOG_POWER, "\r\nEntering DeepSleep mode...\r\n");
+	DBG_LOG_INFO(APP_LOG_POWER, "Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
+#if (APP_DEBUG_CONSOLE_WAKEUP_ENABLE > 0U)
+	if (s_consoleWakeup)
+	{
+		DBG_LOG_INFO(APP_LOG_POWER, "Or send any character on the debug console to wakeup, the character is kept as the next input.\r\n");
+	}
+#endif
 }
 
 static void APP_SetPowerDownMode(app_power_mode_t targetPowerMode)
 {
 	APP_SetCoreFreqAndLDO(targetPowerMode);
 	APP_SetRAMRetention(targetPowerMode);
-	PRINTF("\r\nEntering PowerDown mode...\r\n");
-	PRINTF("Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
+	DBG_LOG_INFO(APP_LOG_POWER, "\r\nEntering PowerDown mode...\r\n");
+	DBG_LOG_INFO(APP_LOG_POWER, "Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
 }
 
 static void APP_SetDeepPowerDownMode(app_power_mode_t targetPowerMode)
 {
 	APP_SetCoreFreqAndLDO(targetPowerMode);
 	APP_SetRAMRetention(targetPowerMode);
-	PRINTF("\r\nEntering DeepPowerDown mode...\r\n");
-	PRINTF("Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
+	DBG_LOG_INFO(APP_LOG_POWER, "\r\nEntering DeepPowerDown mode...\r\n");
+	DBG_LOG_INFO(APP_LOG_POWER, "Please press %s to wakeup.(Please only press the wakeup button when this message appears, otherwise it will result in failure to wake up!)\r\n", APP_WUU_WAKEUP_BUTTON_NAME);
 }
 
 static void APP_SetCoreFreqAndLDO(app_power_mode_t targetPowerMode)
@@ -380,17 +578,17 @@ static void APP_SetCoreFreqAndLDO(app_power_mode_t targetPowerMode)
 
 	do
 	{
-		PRINTF("\r\nSelect the desired Core Frequency and LDO configuration:\n\r\n");
-		PRINTF("\tA: CPU_CLK=96MHz(FRO192M), VDD_CORE=1.1V\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\r\nSelect the desired Core Frequency and LDO configuration:\n\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\tA: CPU_CLK=96MHz(FRO192M), VDD_CORE=1.1V\r\n");
 		if(targetPowerMode == kAPP_PowerModePowerDown)
 		{
-			PRINTF("\tB: CPU_CLK=48MHz(FRO192M), VDD_CORE=0.6V\r\n");
-			PRINTF("\tC: CPU_CLK=12MHz(FRO12M) , VDD_CORE=0.6V\n\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tB: CPU_CLK=48MHz(FRO192M), VDD_CORE=0.6V\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tC: CPU_CLK=12MHz(FRO12M) , VDD_CORE=0.6V\n\r\n");
 		}
 		else
 		{
-			PRINTF("\tB: CPU_CLK=48MHz(FRO192M), VDD_CORE=1.0V\r\n");
-			PRINTF("\tC: CPU_CLK=12MHz(FRO12M) , VDD_CORE=1.0V\n\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tB: CPU_CLK=48MHz(FRO192M), VDD_CORE=1.0V\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tC: CPU_CLK=12MHz(FRO12M) , VDD_CORE=1.0V\n\r\n");
 		}
 
 		ch = GETCHAR();
@@ -401,7 +599,7 @@ static void APP_SetCoreFreqAndLDO(app_power_mode_t targetPowerMode)
         }
 		if((ch < 'A') || (ch > 'C'))
 		{
-			PRINTF("Wrong Input!");
+			DBG_LOG_WARN(APP_LOG_MENU, "Wrong Input!");
 		}
 
 	}while((ch < 'A') || (ch > 'C'));
@@ -409,20 +607,20 @@ static void APP_SetCoreFreqAndLDO(app_power_mode_t targetPowerMode)
 	switch(ch)
 	{
 		case 'A':
-			PRINTF("\tSelect CPU_CLK=96MHz(FRO192M), VDD_CORE=1.1V\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect CPU_CLK=96MHz(FRO192M), VDD_CORE=1.1V\r\n");
 			SPC_SetLowPowerWakeUpDelay(APP_SPC, 0x0);
 			BOARD_BootClockFRO96M(kSPC_CoreLDO_NormalVoltage, kSPC_CoreLDO_NormalDriveStrength);
 			break;
 		case 'B':
 			if(targetPowerMode == kAPP_PowerModePowerDown)
 			{
-				PRINTF("\tSelect CPU_CLK=48MHz(FRO192M), VDD_CORE=0.6V\r\n");
+				DBG_LOG_INFO(APP_LOG_MENU, "\tSelect CPU_CLK=48MHz(FRO192M), VDD_CORE=0.6V\r\n");
 				SPC_SetLowPowerWakeUpDelay(APP_SPC, 0x5b);
 				BOARD_BootClockFRO48M(kSPC_Core_LDO_RetentionVoltage, kSPC_CoreLDO_LowDriveStrength);
 			}
 			else
 			{
-				PRINTF("\tSelect CPU_CLK=48MHz(FRO192M), VDD_CORE=1.0V\r\n");
+				DBG_LOG_INFO(APP_LOG_MENU, "\tSelect CPU_CLK=48MHz(FRO192M), VDD_CORE=1.0V\r\n");
 				SPC_SetLowPowerWakeUpDelay(APP_SPC, 0x0);
 				BOARD_BootClockFRO48M(kSPC_CoreLDO_MidDriveVoltage, kSPC_CoreLDO_LowDriveStrength);
 			}
@@ -430,13 +628,13 @@ static void APP_SetCoreFreqAndLDO(app_power_mode_t targetPowerMode)
 		case 'C':
 			if(targetPowerMode == kAPP_PowerModePowerDown)
 			{
-				PRINTF("\tSelect CPU_CLK=12MHz(FRO12M), VDD_CORE=0.6V\r\n");
+				DBG_LOG_INFO(APP_LOG_MENU, "\tSelect CPU_CLK=12MHz(FRO12M), VDD_CORE=0.6V\r\n");
 				SPC_SetLowPowerWakeUpDelay(APP_SPC, 0x5b);
 				BOARD_BootClockFRO12M(kSPC_Core_LDO_RetentionVoltage, kSPC_CoreLDO_LowDriveStrength);
 			}
 			else
 			{
-				PRINTF("\tSelect CPU_CLK=12MHz(FRO12M), VDD_CORE=1.0V\r\n");
+				DBG_LOG_INFO(APP_LOG_MENU, "\tSelect CPU_CLK=12MHz(FRO12M), VDD_CORE=1.0V\r\n");
 				SPC_SetLowPowerWakeUpDelay(APP_SPC, 0x0);
 				if(targetPowerMode == kAPP_PowerModeSleep)
 				{
@@ -460,12 +658,22 @@ static void APP_SetCoreFreqAndLDO(app_power_mode_t targetPowerMode)
 static void APP_SetSIRC(void)
 {
 	uint8_t ch;
+#if (APP_DEBUG_CONSOLE_WAKEUP_ENABLE > 0U)
+	uint8_t lastOption = 'C';
+
+	s_consoleWakeup = false;
+#else
+	uint8_t lastOption = 'B';
+#endif
 
 	do
 	{
-		PRINTF("\r\nConfigure FRO12M in DeepSleep mode:\n\r\n");
-		PRINTF("\tA: Enable FRO12M and clock to peripherals in DeepSleep mode\r\n");
-		PRINTF("\tB: Disable FROM12M in DeepSleep mode\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\r\nConfigure FRO12M in DeepSleep mode:\n\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\tA: Enable FRO12M and clock to peripherals in DeepSleep mode\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\tB: Disable FROM12M in DeepSleep mode\r\n");
+#if (APP_DEBUG_CONSOLE_WAKEUP_ENABLE > 0U)
+		DBG_LOG_INFO(APP_LOG_MENU, "\tC: Enable FRO12M in DeepSleep mode, debug console input as wakeup source\r\n");
+#endif
 
 		ch = GETCHAR();
 
@@ -473,17 +681,17 @@ static void APP_SetSIRC(void)
         {
             ch -= 'a' - 'A';
         }
-		if((ch < 'A') || (ch > 'B'))
+		if((ch < 'A') || (ch > lastOption))
 		{
-			PRINTF("Wrong Input!");
+			DBG_LOG_WARN(APP_LOG_MENU, "Wrong Input!");
 		}
 
-	}while((ch < 'A') || (ch > 'B'));
+	}while((ch < 'A') || (ch > lastOption));
 
 	switch(ch)
 	{
 		case 'A':
-			PRINTF("\tSelect ENABLE FRO12M in DeepSleep mode\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect ENABLE FRO12M in DeepSleep mode\r\n");
 		    /* Unlock SIRCCSR */
 		    SCG0->SIRCCSR &= ~SCG_SIRCCSR_LK_MASK;
 
@@ -494,7 +702,7 @@ static void APP_SetSIRC(void)
 		    SCG0->SIRCCSR |= SCG_SIRCCSR_LK_MASK;
 			break;
 		case 'B':
-			PRINTF("\tSelect DISABLE FRO12M in DeepSleep mode\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect DISABLE FRO12M in DeepSleep mode\r\n");
 		    /* Unlock SIRCCSR */
 		    SCG0->SIRCCSR &= ~SCG_SIRCCSR_LK_MASK;
 
@@ -503,6 +711,21 @@ static void APP_SetSIRC(void)
 			/* Lock SIRCCSR */
 		    SCG0->SIRCCSR |= SCG_SIRCCSR_LK_MASK;
 			break;
+#if (APP_DEBUG_CONSOLE_WAKEUP_ENABLE > 0U)
+		case 'C':
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect ENABLE FRO12M in DeepSleep mode, debug console input as wakeup source\r\n");
+			/* The debug console LPUART is clocked by FRO12M, it keeps receiving in DeepSleep. */
+			s_consoleWakeup = true;
+		    /* Unlock SIRCCSR */
+		    SCG0->SIRCCSR &= ~SCG_SIRCCSR_LK_MASK;
+
+			SCG0->SIRCCSR |= SCG_SIRCCSR_SIRCSTEN_MASK;
+			SCG0->SIRCCSR |= SCG_SIRCCSR_SIRC_CLK_PERIPH_EN_MASK;
+
+			/* Lock SIRCCSR */
+		    SCG0->SIRCCSR |= SCG_SIRCCSR_LK_MASK;
+			break;
+#endif
 		default:
 			assert(false);
 			break;
@@ -515,19 +738,19 @@ static void APP_SetRAMRetention(app_power_mode_t targetPowerMode)
 
 	do
 	{
-		PRINTF("\r\nConfigure the RAM retention:\n\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\r\nConfigure the RAM retention:\n\r\n");
 		if(targetPowerMode == kAPP_PowerModeDeepPowerDown)
 		{
-			PRINTF("\tA: No RAM retained\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tA: No RAM retained\r\n");
 		}
-		PRINTF("\tB: All RAM retained\r\n");
-		PRINTF("\tC: RAMX0/X1, RAMA0~A3 retained\r\n");
-		PRINTF("\tD: RAMX0/X1/A0 retained\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\tB: All RAM retained\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\tC: RAMX0/X1, RAMA0~A3 retained\r\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\tD: RAMX0/X1/A0 retained\r\n");
 		if(targetPowerMode == kAPP_PowerModeDeepPowerDown)
 		{
-			PRINTF("\tE: RAMA0 retained\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tE: RAMA0 retained\r\n");
 		}
-		PRINTF("\tF: RAMX0/X1 retained\r\n\n");
+		DBG_LOG_INFO(APP_LOG_MENU, "\tF: RAMX0/X1 retained\r\n\n");
 
 		ch = GETCHAR();
 
@@ -538,7 +761,7 @@ static void APP_SetRAMRetention(app_power_mode_t targetPowerMode)
 
 		if((ch < 'A') || (ch > 'F'))
 		{
-			PRINTF("Wrong Input!");
+			DBG_LOG_WARN(APP_LOG_MENU, "Wrong Input!");
 		}
 	}while((ch < 'A') || (ch > 'F'));
 
@@ -548,23 +771,23 @@ static void APP_SetRAMRetention(app_power_mode_t targetPowerMode)
 		case 'A':
 			if(targetPowerMode == kAPP_PowerModeDeepPowerDown)
 			{
-				PRINTF("\tSelect No RAM retained\r\n");
+				DBG_LOG_INFO(APP_LOG_MENU, "\tSelect No RAM retained\r\n");
 				SPC0->LP_CFG &= ~SPC_LP_CFG_SRAMLDO_DPD_ON_MASK;
 			}
 			break;
 		case 'B':
-			PRINTF("\tSelect All RAM retained\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect All RAM retained\r\n");
 			SPC0->LP_CFG |= SPC_LP_CFG_SRAMLDO_DPD_ON_MASK;
 			SPC0->SRAMRETLDO_CNTRL |= SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_MASK;
 			break;
 		case 'C':
-			PRINTF("\tSelect RAMX0/X1, RAMA0~A3 retained\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect RAMX0/X1, RAMA0~A3 retained\r\n");
 			SPC0->LP_CFG |= SPC_LP_CFG_SRAMLDO_DPD_ON_MASK;
 	        SPC0->SRAMRETLDO_CNTRL &= ~SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_MASK;
 	        SPC0->SRAMRETLDO_CNTRL |= (7 << SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_SHIFT);
 			break;
 		case 'D':
-			PRINTF("\tSelect RAMX0/X1/A0 retained\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect RAMX0/X1/A0 retained\r\n");
 			SPC0->LP_CFG |= SPC_LP_CFG_SRAMLDO_DPD_ON_MASK;
 	        SPC0->SRAMRETLDO_CNTRL &= ~SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_MASK;
 	        SPC0->SRAMRETLDO_CNTRL |= (3 << SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_SHIFT);
@@ -572,14 +795,14 @@ static void APP_SetRAMRetention(app_power_mode_t targetPowerMode)
 		case 'E':
 			if(targetPowerMode == kAPP_PowerModeDeepPowerDown)
 			{
-				PRINTF("\tSelect RAMA0 retained\r\n");
+				DBG_LOG_INFO(APP_LOG_MENU, "\tSelect RAMA0 retained\r\n");
 				SPC0->LP_CFG |= SPC_LP_CFG_SRAMLDO_DPD_ON_MASK;
 				SPC0->SRAMRETLDO_CNTRL &= ~SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_MASK;
 				SPC0->SRAMRETLDO_CNTRL |= (2 << SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_SHIFT);
 			}
 			break;
 		case 'F':
-			PRINTF("\tSelect RAMX0/RAMX1 retained\r\n");
+			DBG_LOG_INFO(APP_LOG_MENU, "\tSelect RAMX0/RAMX1 retained\r\n");
 			SPC0->LP_CFG |= SPC_LP_CFG_SRAMLDO_DPD_ON_MASK;
 	        SPC0->SRAMRETLDO_CNTRL &= ~SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_MASK;
 	        SPC0->SRAMRETLDO_CNTRL |= (1 << SPC_SRAMRETLDO_CNTRL_SRAM_RET_EN_SHIFT);
@@ -593,9 +816,7 @@ static void APP_SetRAMRetention(app_power_mode_t targetPowerMode)
 /* Get wakeup timeout and wakeup source. */
 static void APP_GetWakeupConfig(app_power_mode_t targetMode)
 {
-    char *isoDomains = NULL;
-
-    PRINTF("Wakeup Button Selected As Wakeup Source.\r\n");
+    DBG_LOG_INFO(APP_LOG_POWER, "Wakeup Button Selected As Wakeup Source.\r\n");
     /* Set WUU to detect on rising edge for all power modes. */
     wuu_external_wakeup_pin_config_t wakeupButtonConfig;
 
@@ -603,26 +824,242 @@ static void APP_GetWakeupConfig(app_power_mode_t targetMode)
     wakeupButtonConfig.event = kWUU_ExternalPinInterrupt;
     wakeupButtonConfig.mode  = kWUU_ExternalPinActiveAlways;
     WUU_SetExternalWakeUpPinsConfig(APP_WUU, 9, &wakeupButtonConfig);
+    /* The WUU interrupt posts the wakeup event to the main loop. */
+    EnableIRQ(APP_WUU_IRQN);
 
     if (targetMode > kAPP_PowerModeSleep)
     {
         /* Isolate some power domains that are not used in low power modes.*/
         SPC_SetExternalVoltageDomainsConfig(APP_SPC, APP_SPC_ISO_VALUE, 0x0U);
-        isoDomains = APP_SPC_ISO_DOMAINS;
-        PRINTF("Isolate power domains: %s\r\n", isoDomains);
+        DBG_LOG_DEBUG(APP_LOG_POWER, "Isolate power domains: %s\r\n", APP_SPC_ISO_DOMAINS);
+    }
+}
+
+static void APP_FlushTrace(void)
+{
+    retained_trace_record_t record;
+
+    if (0U == RetainedTrace_Init())
+    {
+        return;
+    }
+
+    DBG_LOG_WARN(APP_LOG_TRACE, "\r\nTrace of the previous run:\r\n");
+    while (RetainedTrace_Pop(&record))
+    {
+        if (record.event < (uint16_t)kAPP_TraceEventCount)
+        {
+            DBG_LOG_WARN(APP_LOG_TRACE, "  #%u %s 0x%x\r\n", record.sequence, g_traceEventNameArray[record.event],
+                         record.value);
+        }
+        else
+        {
+            DBG_LOG_WARN(APP_LOG_TRACE, "  #%u event %u 0x%x\r\n", record.sequence, record.event, record.value);
+        }
+    }
+}
+
+static void APP_RestoreRetainedState(void)
+{
+    /* Nothing is placed in RAMA0 by the demo, the check guards RETAINED_DATA_RAMA0 variables added later. */
+    assert(RetainedData_IsInRama0());
+
+    if (!RetainedData_IsValid(&s_appRetainedState.header, &s_appRetainedState.wakeupCount,
+                              sizeof(s_appRetainedState.wakeupCount)))
+    {
+        s_appRetainedState.wakeupCount = 0U;
+        DBG_LOG_DEBUG(APP_LOG_POWER, "\r\nRetained state lost, initialized.\r\n");
+    }
+    else if ((CMC_GetSystemResetStatus(APP_CMC) & kCMC_WakeUpReset) != 0UL)
+    {
+        s_appRetainedState.wakeupCount++;
+    }
+    else
+    {
+        /* Warm reset, the retained state is kept as is. */
+    }
+    RetainedData_Commit(&s_appRetainedState.header, &s_appRetainedState.wakeupCount,
+                        sizeof(s_appRetainedState.wakeupCount));
+
+    DBG_LOG_DEBUG(APP_LOG_POWER, "DeepPowerDown wakeups since the retained state was lost: %u\r\n",
+                  s_appRetainedState.wakeupCount);
+}
+
+void APP_WUU_IRQ_HANDLER(void)
+{
+    uint32_t flags = WUU_GetExternalWakeUpPinsFlag(APP_WUU);
+    uint32_t event = APP_EVENT(kAPP_EventWakeupPin, flags);
+
+    WUU_ClearExternalWakeUpPinsFlag(APP_WUU, flags);
+    /* The event is dropped if the main loop is behind, the queue is never blocked on. */
+    (void)SpscQueue_Push(&s_appEventQueue, &event, 1U);
+    SDK_ISR_EXIT_BARRIER;
+}
+
+static void APP_HandleEvents(void)
+{
+    uint32_t events[APP_EVENT_QUEUE_SIZE];
+    uint32_t count;
+    uint32_t i;
+
+    count = SpscQueue_Pop(&s_appEventQueue, events, APP_EVENT_QUEUE_SIZE);
+    for (i = 0U; i < count; i++)
+    {
+        switch (APP_EVENT_TYPE(events[i]))
+        {
+            case kAPP_EventWakeupPin:
+                DBG_LOG_DEBUG(APP_LOG_POWER, "Woken up by WUU pin flags 0x%x.\r\n", APP_EVENT_VALUE(events[i]));
+                break;
+            default:
+                DBG_LOG_WARN(APP_LOG_POWER, "Unknown event 0x%x.\r\n", events[i]);
+                break;
+        }
+    }
+}
+
+static void APP_TimerDemoCallback(void *param)
+{
+    app_demo_timer_t *demoTimer = (app_demo_timer_t *)param;
+
+    demoTimer->callbacks++;
+}
+
+static void APP_RunTimerDemo(app_power_mode_t targetPowerMode)
+{
+    s_timerDemoFast.callbacks = 0U;
+    s_timerDemoSlow.callbacks = 0U;
+    s_timerDemoWakeupBase     = TimerService_GetWakeupCount();
+
+    TimerService_Start(&s_timerDemoFast.timer, TIMER_SERVICE_MS_TO_TICKS(APP_TIMER_DEMO_PERIOD_MS),
+                       TIMER_SERVICE_MS_TO_TICKS(APP_TIMER_DEMO_PERIOD_MS), 0U);
+    TimerService_Start(&s_timerDemoSlow.timer, TIMER_SERVICE_MS_TO_TICKS(APP_TIMER_DEMO_SLOW_DELAY_MS),
+                       TIMER_SERVICE_MS_TO_TICKS(APP_TIMER_DEMO_SLOW_PERIOD_MS),
+                       TIMER_SERVICE_MS_TO_TICKS(APP_TIMER_DEMO_SLOW_SLACK_MS));
+
+    /* The core resumes here after each timer interrupt, back to low power mode until the button is pressed. */
+    while ((s_timerDemoFast.callbacks < APP_TIMER_DEMO_CALLBACKS) && (0U == SpscQueue_GetCount(&s_appEventQueue)))
+    {
+        APP_PowerModeSwitch(targetPowerMode);
+    }
+
+    TimerService_Stop(&s_timerDemoFast.timer);
+    TimerService_Stop(&s_timerDemoSlow.timer);
+}
+
+static void APP_PrintTimerDemo(void)
+{
+    /* The slow timer is deferred into the wakeups of the periodic one, so there are fewer wakeups than callbacks. */
+    DBG_LOG_INFO(APP_LOG_POWER, "Timer service: %u + %u callbacks in %u wakeups from %s.\r\n",
+                 s_timerDemoFast.callbacks, s_timerDemoSlow.callbacks,
+                 TimerService_GetWakeupCount() - s_timerDemoWakeupBase,
+                 g_modeNameArray[(uint8_t)(s_timerDemoMode - kAPP_PowerModeActive)]);
+}
+
+static void APP_PrintBootProfile(void)
+{
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    uint32_t i;
+
+    DBG_LOG_INFO(APP_LOG_BOOT, "\r\nBoot profile, CPU cycles from the reset handler entry:\r\n");
+    for (i = 0U; i < (uint32_t)kBOOT_PROFILE_PhaseCount; i++)
+    {
+        DBG_LOG_INFO(APP_LOG_BOOT, "  %s %u\r\n", g_bootPhaseNameArray[i], g_bootProfile.timestamps[i]);
     }
+    for (i = 0U; i < MIN(g_bootProfile.dataSectionCount, BOOT_PROFILE_SECTION_COUNT); i++)
+    {
+        DBG_LOG_INFO(APP_LOG_BOOT, "  data 0x%x %u bytes %u cycles\r\n", g_bootProfile.dataSections[i].address,
+                     g_bootProfile.dataSections[i].length, g_bootProfile.dataSections[i].cycles);
+    }
+    for (i = 0U; i < MIN(g_bootProfile.bssSectionCount, BOOT_PROFILE_SECTION_COUNT); i++)
+    {
+        DBG_LOG_INFO(APP_LOG_BOOT, "  bss 0x%x %u bytes %u cycles\r\n", g_bootProfile.bssSections[i].address,
+                     g_bootProfile.bssSections[i].length, g_bootProfile.bssSections[i].cycles);
+    }
+#endif
+}
+
+static void APP_PrintRamFootprint(void)
+{
+    ram_footprint_t footprint;
+
+    RamFootprint_Get(&footprint);
+
+    DBG_LOG_INFO(APP_LOG_MENU, "\r\nRAM footprint, static sections from the region start:\r\n");
+    DBG_LOG_INFO(APP_LOG_MENU, "  SRAM  0x%x: %u of %u bytes\r\n", footprint.sram.base, footprint.sram.staticSize,
+                 footprint.sram.size);
+    DBG_LOG_INFO(APP_LOG_MENU, "  SRAMX 0x%x: %u of %u bytes\r\n", footprint.sramx.base, footprint.sramx.staticSize,
+                 footprint.sramx.size);
+#if (defined(RAM_FOOTPRINT_PAINT_ENABLE) && (RAM_FOOTPRINT_PAINT_ENABLE > 0U))
+    DBG_LOG_INFO(APP_LOG_MENU, "  Heap  0x%x: %u of %u bytes used\r\n", footprint.heapBase, footprint.heapUsed,
+                 footprint.heapSize);
+    DBG_LOG_INFO(APP_LOG_MENU, "  Stack 0x%x: %u of %u bytes used\r\n", footprint.stackTop, footprint.stackUsed,
+                 footprint.stackSize);
+#else
+    DBG_LOG_INFO(APP_LOG_MENU, "  Heap  0x%x: %u bytes, Stack 0x%x: %u bytes, build with RAM_FOOTPRINT_PAINT_ENABLE for the usage\r\n",
+                 footprint.heapBase, footprint.heapSize, footprint.stackTop, footprint.stackSize);
+#endif
 }
 
 static void APP_PowerPreSwitchHook(void)
 {
-    /* Wait for debug console output finished. */
-    while (!(kLPUART_TransmissionCompleteFlag & LPUART_GetStatusFlags((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR)))
+    uint32_t keptClocks = 0U;
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_DEBUG)
+    uint32_t coreFreq = CLOCK_GetFreq(kCLOCK_CoreSysClk);
+    uint32_t startCycles;
+#endif
+
+    /* Empty the debug console TX ring buffer if it is enabled, only the UART itself is drained below. */
+    (void)DbgConsole_Flush();
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_DEBUG)
+    MSDK_EnableCpuCycleCounter();
+    startCycles         = MSDK_GetCpuCycleCount();
+    s_consoleDrainChars = LPUART_GetTxFifoCount((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR);
+    if (0U == (LPUART_GetStatusFlags((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR) &
+               (uint32_t)kLPUART_TransmissionCompleteFlag))
     {
+        /* One more character in the shift register. */
+        s_consoleDrainChars++;
     }
-    APP_DeinitDebugConsole();
+#endif
+    /*
+     * Wait for debug console output finished, the core sleeps until transmission complete. The LPUART
+     * transmits on its own here and keeps its clock in Sleep, so the wait ends within the TX FIFO size
+     * plus one frames, a cycle counter timeout would stop the core from sleeping.
+     */
+    (void)LPUART_WaitTransmitComplete((LPUART_Type *)BOARD_DEBUG_UART_BASEADDR, 0U);
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_DEBUG)
+    s_consoleDrainActiveUs = (uint32_t)COUNT_TO_USEC(MSDK_GetCpuCycleCount() - startCycles, coreFreq);
+#endif
+#if (APP_DEBUG_CONSOLE_WAKEUP_ENABLE > 0U)
+    if (s_consoleWakeup)
+    {
+        /*
+         * Keep the debug console, its RX pin and clock. The LPUART receives the first character in DeepSleep,
+         * the RX interrupt wakes up the device and stores it in the debug console RX ring buffer.
+         */
+        keptClocks = APP_DEBUG_CONSOLE_MRCC_MASK;
+    }
+    else
+#endif
+    {
+        APP_DeinitDebugConsole();
+    }
+
+    /* Park the unused pins while their PORT clocks are still on. */
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_DEBUG)
+    s_parkedPinCount = PinPark_Park();
+#else
+    (void)PinPark_Park();
+#endif
+
+    /*
+     * LPTMR0 of the timer service keeps running: it has no bit in MRCC_GLB_CC0/CC1 (see MCXA156.h), so the
+     * writes below do not gate it. It counts clk_16k, which must stay enabled to the core domain.
+     */
+    assert(0U != (VBAT0->FROCLKE & (uint32_t)kCLKE_16K_COREMAIN));
 
     SYSCON->CLKUNLOCK &= ~SYSCON_CLKUNLOCK_UNLOCK_MASK;
-    MRCC0->MRCC_GLB_CC0 = 0x00008000;
+    MRCC0->MRCC_GLB_CC0 = 0x00008000 | keptClocks;
     MRCC0->MRCC_GLB_CC1 = 0x000C0000;
     MRCC0->MRCC_GLB_ACC0 = 0x00008000;
     MRCC0->MRCC_GLB_ACC1 = 0x000C0000;
@@ -640,7 +1077,27 @@ static void APP_PowerPostSwitchHook(void)
     MRCC0->MRCC_GLB_ACC0 = 0x08008000;
     MRCC0->MRCC_GLB_ACC1 = 0x020C0000;
     SYSCON->CLKUNLOCK |= SYSCON_CLKUNLOCK_UNLOCK_MASK;
-    APP_InitDebugConsole();
+    PinPark_Restore();
+    /* Debug console input is waited for with WFI, make sure it is Sleep mode again after the wakeup. */
+    CMC_SetClockMode(APP_CMC, kCMC_GateNoneClock);
+    CMC_SetMAINPowerMode(APP_CMC, kCMC_ActiveOrSleepMode);
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+#if (APP_DEBUG_CONSOLE_WAKEUP_ENABLE > 0U)
+    if (s_consoleWakeup)
+    {
+        /* The debug console was kept running, re-initializing it would drop the received character. */
+        s_consoleWakeup = false;
+    }
+    else
+#endif
+    {
+        APP_InitDebugConsole();
+    }
+    DBG_LOG_DEBUG(APP_LOG_POWER, "Debug console drained %u characters, about %u us, %u us of it awake.\r\n",
+                  s_consoleDrainChars,
+                  (s_consoleDrainChars * APP_DEBUG_CONSOLE_FRAME_BITS * 1000000U) / BOARD_DEBUG_UART_BAUDRATE,
+                  s_consoleDrainActiveUs);
+    DBG_LOG_DEBUG(APP_LOG_POWER, "%u unused pins parked in low power mode.\r\n", s_parkedPinCount);
 }
 
 static void APP_PowerModeSwitch(app_power_mode_t targetPowerMode)
@@ -34,6 +34,15 @@ extern "C" {
 #define WEAK_AV __attribute__ ((weak, section(".after_vectors")))
 #define ALIAS(f) __attribute__ ((weak, alias (#f)))
 
+#include "fsl_boot_profile.h"
+#include "fsl_ram_footprint.h"
+
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+// Core debug and DWT registers used to count the boot cycles
+#define BOOT_PROFILE_DEMCR      (*(volatile unsigned int *) 0xE000EDFC)
+#define BOOT_PROFILE_DWT_CTRL   (*(volatile unsigned int *) 0xE0001000)
+#endif // (BOOT_PROFILE_ENABLE)
+
 //*****************************************************************************
 #if defined (__cplusplus)
 extern "C" {
@@ -403,27 +412,109 @@ void (* const g_pfnVectors[])(void) = {
     QDC1_INDEX_IRQHandler,             // 104: Index / Roll Over / Roll Under
 }; /* End of g_pfnVectors */
 
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+//*****************************************************************************
+// Boot profile record, placed in .noinit as it is written while the data and
+// bss sections are being initialized.
+//*****************************************************************************
+__attribute__ ((section(".noinit")))
+boot_profile_t g_bootProfile;
+
+__attribute__ ((section(".after_vectors.init_profile")))
+void boot_profile_init(void) {
+    unsigned int phase;
+    // Enable the DWT cycle counter and count from the reset handler entry
+    BOOT_PROFILE_DEMCR |= 0x01000000;     // TRCENA
+    BOOT_PROFILE_CYCCNT = 0;
+    BOOT_PROFILE_DWT_CTRL |= 0x00000001;  // CYCCNTENA
+    for (phase = 0; phase < kBOOT_PROFILE_PhaseCount; phase++)
+        g_bootProfile.timestamps[phase] = 0;
+    g_bootProfile.timestamps[kBOOT_PROFILE_ResetEntry] = BOOT_PROFILE_CYCCNT;
+    g_bootProfile.dataSectionCount = 0;
+    g_bootProfile.bssSectionCount = 0;
+}
+
+__attribute__ ((section(".after_vectors.init_profile")))
+void boot_profile_add_section(boot_profile_section_t *sections, uint32_t *count,
+                              unsigned int start, unsigned int len, unsigned int cycles) {
+    if (*count < BOOT_PROFILE_SECTION_COUNT) {
+        sections[*count].address = start;
+        sections[*count].length = len;
+        sections[*count].cycles = BOOT_PROFILE_CYCCNT - cycles;
+    }
+    *count = *count + 1;
+}
+#endif // (BOOT_PROFILE_ENABLE)
+
+#if (defined(RAM_FOOTPRINT_PAINT_ENABLE) && (RAM_FOOTPRINT_PAINT_ENABLE > 0U))
+//*****************************************************************************
+// Fill the heap and the stack not used yet with a known pattern, so that their
+// high-water marks can be measured at runtime.
+//*****************************************************************************
+extern unsigned int _pvHeapStart;
+extern unsigned int _pvHeapLimit;
+
+__attribute__ ((section(".after_vectors.init_paint")))
+void ram_footprint_paint(void) {
+    unsigned int *pulDest;
+    unsigned int *pulSP;
+    __asm volatile ("MOV %0, SP" : "=r"(pulSP));
+    for (pulDest = &_pvHeapStart; pulDest < &_pvHeapLimit; pulDest++)
+        *pulDest = RAM_FOOTPRINT_PAINT_PATTERN;
+    for (pulDest = (unsigned int *)_vStackBase; pulDest < pulSP; pulDest++)
+        *pulDest = RAM_FOOTPRINT_PAINT_PATTERN;
+}
+#endif // (RAM_FOOTPRINT_PAINT_ENABLE)
+
 //*****************************************************************************
 // Functions to carry out the initialization of RW and BSS data sections. These
 // are written as separate functions rather than being inlined within the
 // ResetISR() function in order to cope with MCUs with multiple banks of
-// memory.
+// memory. The sections are word aligned, so both functions move 16 bytes per
+// iteration with LDM/STM, then finish with single words.
 //*****************************************************************************
 __attribute__ ((section(".after_vectors.init_data")))
 void data_init(unsigned int romstart, unsigned int start, unsigned int len) {
     unsigned int *pulDest = (unsigned int*) start;
     unsigned int *pulSrc = (unsigned int*) romstart;
     unsigned int loop;
-    for (loop = 0; loop < len; loop = loop + 4)
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    unsigned int cycles = BOOT_PROFILE_CYCCNT;
+#endif // (BOOT_PROFILE_ENABLE)
+    for (loop = 0; (loop + 16) <= len; loop = loop + 16)
+        __asm volatile ("LDMIA %0!, {r2, r3, r4, r5}  \n"
+                        "STMIA %1!, {r2, r3, r4, r5}  \n"
+                        : "+r"(pulSrc), "+r"(pulDest)
+                        :
+                        : "r2", "r3", "r4", "r5", "memory");
+    for (; loop < len; loop = loop + 4)
         *pulDest++ = *pulSrc++;
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    boot_profile_add_section(g_bootProfile.dataSections, &g_bootProfile.dataSectionCount, start, len, cycles);
+#endif // (BOOT_PROFILE_ENABLE)
 }
 
 __attribute__ ((section(".after_vectors.init_bss")))
 void bss_init(unsigned int start, unsigned int len) {
     unsigned int *pulDest = (unsigned int*) start;
     unsigned int loop;
-    for (loop = 0; loop < len; loop = loop + 4)
+    register unsigned int zero0 __asm("r2") = 0;
+    register unsigned int zero1 __asm("r3") = 0;
+    register unsigned int zero2 __asm("r4") = 0;
+    register unsigned int zero3 __asm("r5") = 0;
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    unsigned int cycles = BOOT_PROFILE_CYCCNT;
+#endif // (BOOT_PROFILE_ENABLE)
+    for (loop = 0; (loop + 16) <= len; loop = loop + 16)
+        __asm volatile ("STMIA %0!, {%1, %2, %3, %4}  \n"
+                        : "+r"(pulDest)
+                        : "r"(zero0), "r"(zero1), "r"(zero2), "r"(zero3)
+                        : "memory");
+    for (; loop < len; loop = loop + 4)
         *pulDest++ = 0;
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    boot_profile_add_section(g_bootProfile.bssSections, &g_bootProfile.bssSectionCount, start, len, cycles);
+#endif // (BOOT_PROFILE_ENABLE)
 }
 
 //*****************************************************************************
@@ -457,11 +548,20 @@ void ResetISR(void) {
                     : "r"(g_pfnVectors), "r"(_vStackBase)
                     : "r0", "r1");
 
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    boot_profile_init();
+#endif // (BOOT_PROFILE_ENABLE)
+
+#if (defined(RAM_FOOTPRINT_PAINT_ENABLE) && (RAM_FOOTPRINT_PAINT_ENABLE > 0U))
+    ram_footprint_paint();
+#endif // (RAM_FOOTPRINT_PAINT_ENABLE)
+
 #if defined (__USE_CMSIS)
 // If __USE_CMSIS defined, then call CMSIS SystemInit code
     SystemInit();
 
 #endif // (__USE_CMSIS)
+    BootProfile_Mark(kBOOT_PROFILE_SystemInit);
 
     //
     // Copy the data sections from flash to SRAM.
@@ -479,6 +579,7 @@ void ResetISR(void) {
         SectionLen = *SectionTableAddr++;
         data_init(LoadAddr, ExeAddr, SectionLen);
     }
+    BootProfile_Mark(kBOOT_PROFILE_DataInit);
 
     // At this point, SectionTableAddr = &__bss_section_table;
     // Zero fill the bss segment
@@ -487,6 +588,7 @@ void ResetISR(void) {
         SectionLen = *SectionTableAddr++;
         bss_init(ExeAddr, SectionLen);
     }
+    BootProfile_Mark(kBOOT_PROFILE_BssInit);
 
 #if !defined (__USE_CMSIS)
 // Assume that if __USE_CMSIS defined, then CMSIS SystemInit code
@@ -508,6 +610,8 @@ void ResetISR(void) {
     __libc_init_array();
 #endif
 
+    BootProfile_Mark(kBOOT_PROFILE_Startup);
+
     // Reenable interrupts
     __asm volatile ("cpsie i");
 
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+/*
+ * Helpers shared by the host tests and benchmarks.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*! @brief Returns the next value of a fixed seed xorshift generator, so every run checks the same cases. */
+static inline uint64_t HostTest_Random64(void)
+{
+    static uint64_t s_state = 0x9E3779B97F4A7C15ULL;
+
+    s_state ^= s_state << 13U;
+    s_state ^= s_state >> 7U;
+    s_state ^= s_state << 17U;
+    return s_state;
+}
+
+/*! @brief Returns a monotonic time stamp in nanoseconds. */
+static inline uint64_t HostTest_GetTimeNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* _HOST_TEST_H_ */
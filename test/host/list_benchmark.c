@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Measures the deadline list and the priority queue of the generic list at a
+ * fixed number of pending elements. Each step removes one element and adds it
+ * back:
+ * - deadline, in order: the expired head is re-armed with a later deadline than
+ *   all the others, as a periodic timer is, the insertion takes the tail.
+ * - deadline, random: the new deadline is anywhere in the list, the insertion
+ *   scans from the head.
+ * - priority: the highest priority element is removed and added back with a
+ *   random priority.
+ */
+
+#include <stdio.h>
+#include "fsl_component_generic_list.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Remove and add pairs per measurement. */
+#define LIST_BENCHMARK_ITERATIONS 10000000U
+
+/*! @brief Most elements pending in a measurement. */
+#define LIST_BENCHMARK_MAX_DEPTH 64U
+
+/*! @brief Number of precomputed random values, a power of two. */
+#define LIST_BENCHMARK_VALUES 1024U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static list_deadline_element_t s_deadlines[LIST_BENCHMARK_MAX_DEPTH];
+static list_element_t s_elements[LIST_BENCHMARK_MAX_DEPTH];
+static uint32_t s_random[LIST_BENCHMARK_VALUES];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static double MeasureDeadline(uint32_t depth, bool inOrder)
+{
+    list_deadline_element_handle_t element;
+    list_label_t list;
+    uint64_t start;
+    uint32_t now = 0U;
+    uint32_t i;
+
+    LIST_Init(&list, 0U);
+    for (i = 0U; i < depth; i++)
+    {
+        (void)LIST_AddDeadline(&list, &s_deadlines[i], i * 16U);
+    }
+
+    start = HostTest_GetTimeNs();
+    for (i = 0U; i < LIST_BENCHMARK_ITERATIONS; i++)
+    {
+        now     = ((list_deadline_element_handle_t)(void *)LIST_GetHead(&list))->deadline;
+        element = LIST_RemoveExpired(&list, now);
+        if (inOrder)
+        {
+            (void)LIST_AddDeadline(&list, element, now + (depth * 16U));
+        }
+        else
+        {
+            (void)LIST_AddDeadline(&list, element, now + 1U + s_random[i & (LIST_BENCHMARK_VALUES - 1U)]);
+        }
+    }
+    return (double)(HostTest_GetTimeNs() - start) / (double)LIST_BENCHMARK_ITERATIONS;
+}
+
+static double MeasurePriority(uint32_t depth)
+{
+    list_priority_queue_t queue;
+    list_element_handle_t element;
+    uint64_t start;
+    uint32_t i;
+
+    LIST_InitPriorityQueue(&queue);
+    for (i = 0U; i < depth; i++)
+    {
+        (void)LIST_AddPriority(&queue, &s_elements[i], s_random[i] % GENERIC_LIST_PRIORITY_COUNT);
+    }
+
+    start = HostTest_GetTimeNs();
+    for (i = 0U; i < LIST_BENCHMARK_ITERATIONS; i++)
+    {
+        element = LIST_RemoveHighestPriority(&queue);
+        (void)LIST_AddPriority(&queue, element,
+                               s_random[i & (LIST_BENCHMARK_VALUES - 1U)] % GENERIC_LIST_PRIORITY_COUNT);
+    }
+    return (double)(HostTest_GetTimeNs() - start) / (double)LIST_BENCHMARK_ITERATIONS;
+}
+
+int main(void)
+{
+    static const uint32_t s_depths[] = {4U, 16U, LIST_BENCHMARK_MAX_DEPTH};
+    size_t i;
+
+    for (i = 0U; i < LIST_BENCHMARK_VALUES; i++)
+    {
+        /* Timeouts of up to 1024 ticks. */
+        s_random[i] = (uint32_t)(HostTest_Random64() % 1024U);
+    }
+
+    printf("%-6s %18s %18s %14s\n", "depth", "deadline order ns", "deadline rand ns", "priority ns");
+    for (i = 0U; i < (sizeof(s_depths) / sizeof(s_depths[0])); i++)
+    {
+        printf("%-6u %18.1f %18.1f %14.1f\n", (unsigned int)s_depths[i], MeasureDeadline(s_depths[i], true),
+               MeasureDeadline(s_depths[i], false), MeasurePriority(s_depths[i]));
+    }
+    return 0;
+}
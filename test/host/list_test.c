@@ -0,0 +1,362 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Unit test of the deadline list and the priority queue of the generic list,
+ * built once with GENERIC_LIST_LIGHT and once without it. The deadline list is
+ * checked for its order across the wraparound of the ticks and for the removal
+ * of the expired elements, the priority queue against a model for the order of
+ * removal and for the ready mask.
+ */
+
+#include <stdio.h>
+#include "fsl_component_generic_list.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Elements of the random sequences. */
+#define LIST_TEST_ELEMENT_COUNT 48U
+
+/*! @brief Lists filled and drained in the random deadline test. */
+#define LIST_TEST_DEADLINE_ROUNDS 4000U
+
+/*! @brief Steps of the random priority queue sequence. */
+#define LIST_TEST_PRIORITY_STEPS 200000U
+
+/*! @brief Checks a condition, counting and reporting the failures. */
+#define LIST_TEST_CHECK(cond)                                      \
+    do                                                             \
+    {                                                              \
+        s_caseCount++;                                             \
+        if (!(cond))                                               \
+        {                                                          \
+            printf("FAIL line %d: %s\n", __LINE__, #cond);         \
+            s_failCount++;                                         \
+        }                                                          \
+    } while (false)
+
+/*! @brief Deadline element with its insertion order. */
+typedef struct _list_test_deadline
+{
+    list_deadline_element_t element; /*!< Element of the list, first member. */
+    uint32_t sequence;               /*!< Insertion order. */
+} list_test_deadline_t;
+
+/*! @brief Priority queue element with its priority and insertion order. */
+typedef struct _list_test_priority
+{
+    list_element_t element; /*!< Element of the queue, first member. */
+    uint32_t priority;      /*!< Priority the element was added with. */
+    uint32_t sequence;      /*!< Insertion order. */
+    bool queued;            /*!< The element is in the queue. */
+} list_test_priority_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static list_test_deadline_t s_deadlines[LIST_TEST_ELEMENT_COUNT];
+static list_test_priority_t s_priorities[LIST_TEST_ELEMENT_COUNT];
+static uint32_t s_failCount;
+static uint32_t s_caseCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static list_status_t AddDeadline(list_handle_t list, uint32_t index, uint32_t deadline, uint32_t sequence)
+{
+    s_deadlines[index].sequence = sequence;
+    return LIST_AddDeadline(list, &s_deadlines[index].element, deadline);
+}
+
+/* Walks the list, checks the links and the order and returns the elements from the head. */
+static uint32_t CheckDeadlineList(list_handle_t list, list_test_deadline_t **order)
+{
+    list_element_handle_t element = LIST_GetHead(list);
+    list_test_deadline_t *prev    = NULL;
+    list_test_deadline_t *entry;
+    uint32_t count = 0U;
+
+    while ((NULL != element) && (count < LIST_TEST_ELEMENT_COUNT))
+    {
+        entry = (list_test_deadline_t *)(void *)element;
+        LIST_TEST_CHECK(list == LIST_GetList(element));
+#if !(defined(GENERIC_LIST_LIGHT) && (GENERIC_LIST_LIGHT > 0U))
+        LIST_TEST_CHECK(((NULL == prev) ? NULL : &prev->element.link) == LIST_GetPrev(element));
+#endif /* GENERIC_LIST_LIGHT */
+        if (NULL != prev)
+        {
+            /* Earlier deadlines first, equal deadlines in insertion order. */
+            LIST_TEST_CHECK((int32_t)(entry->element.deadline - prev->element.deadline) >= 0);
+            if (entry->element.deadline == prev->element.deadline)
+            {
+                LIST_TEST_CHECK(entry->sequence > prev->sequence);
+            }
+        }
+        order[count++] = entry;
+        prev           = entry;
+        element        = LIST_GetNext(element);
+    }
+
+    LIST_TEST_CHECK(NULL == element);
+    LIST_TEST_CHECK(count == LIST_GetSize(list));
+    LIST_TEST_CHECK(((NULL == prev) ? NULL : &prev->element.link) == list->tail);
+    return count;
+}
+
+static void TestDeadlineWraparound(void)
+{
+    static const uint32_t s_values[] = {0xFFFFFFF0U, 0x00000010U, 0xFFFFFFFFU, 0x00000000U, 0xFFFFFFF0U};
+    static const uint32_t s_expected[] = {0U, 4U, 2U, 3U, 1U};
+    list_test_deadline_t *order[LIST_TEST_ELEMENT_COUNT];
+    list_label_t list;
+    uint32_t i;
+
+    LIST_Init(&list, 0U);
+    for (i = 0U; i < (sizeof(s_values) / sizeof(s_values[0])); i++)
+    {
+        LIST_TEST_CHECK(kLIST_Ok == AddDeadline(&list, i, s_values[i], i));
+    }
+
+    LIST_TEST_CHECK(5U == CheckDeadlineList(&list, order));
+    for (i = 0U; i < (sizeof(s_expected) / sizeof(s_expected[0])); i++)
+    {
+        LIST_TEST_CHECK(&s_deadlines[s_expected[i]] == order[i]);
+    }
+
+    /* Nothing before the first deadline, then the elements in order as the ticks wrap around. */
+    LIST_TEST_CHECK(NULL == LIST_RemoveExpired(&list, 0xFFFFFFEFU));
+    LIST_TEST_CHECK(&s_deadlines[0].element == LIST_RemoveExpired(&list, 0xFFFFFFFFU));
+    LIST_TEST_CHECK(&s_deadlines[4].element == LIST_RemoveExpired(&list, 0xFFFFFFFFU));
+    LIST_TEST_CHECK(&s_deadlines[2].element == LIST_RemoveExpired(&list, 0xFFFFFFFFU));
+    LIST_TEST_CHECK(NULL == LIST_RemoveExpired(&list, 0xFFFFFFFFU));
+    LIST_TEST_CHECK(&s_deadlines[3].element == LIST_RemoveExpired(&list, 0x00000005U));
+    LIST_TEST_CHECK(NULL == LIST_RemoveExpired(&list, 0x0000000FU));
+    LIST_TEST_CHECK(&s_deadlines[1].element == LIST_RemoveExpired(&list, 0x00000010U));
+    LIST_TEST_CHECK(NULL == LIST_RemoveExpired(&list, 0x00000010U));
+    LIST_TEST_CHECK(0U == LIST_GetSize(&list));
+    LIST_TEST_CHECK(NULL == LIST_GetList(&s_deadlines[1].element.link));
+
+    /* The maximum number of elements is kept. */
+    LIST_Init(&list, 1U);
+    LIST_TEST_CHECK(kLIST_Ok == AddDeadline(&list, 0U, 10U, 0U));
+    LIST_TEST_CHECK(kLIST_Full == AddDeadline(&list, 1U, 5U, 1U));
+    LIST_TEST_CHECK(&s_deadlines[0].element == LIST_RemoveExpired(&list, 10U));
+}
+
+static void TestDeadlineRandom(void)
+{
+    /* Duplicates, short timeouts and the widest spread the signed comparison supports. */
+    static const uint32_t s_spans[] = {4U, 1000U, 0x7FFFFFFFU};
+    list_test_deadline_t *order[LIST_TEST_ELEMENT_COUNT];
+    list_deadline_element_handle_t expired;
+    list_label_t list;
+    uint32_t round;
+    uint32_t span;
+    uint32_t base;
+    uint32_t now;
+    uint32_t count;
+    uint32_t removed;
+    uint32_t i;
+
+    for (round = 0U; round < LIST_TEST_DEADLINE_ROUNDS; round++)
+    {
+        span = s_spans[round % (sizeof(s_spans) / sizeof(s_spans[0]))];
+        base = (uint32_t)HostTest_Random64();
+        /* Every other round crosses the wraparound of the ticks. */
+        if (0U != (round & 1U))
+        {
+            base = 0U - (uint32_t)(HostTest_Random64() % ((uint64_t)span + 1U));
+        }
+
+        LIST_Init(&list, 0U);
+        count = 1U + (uint32_t)(HostTest_Random64() % LIST_TEST_ELEMENT_COUNT);
+        for (i = 0U; i < count; i++)
+        {
+            LIST_TEST_CHECK(kLIST_Ok ==
+                            AddDeadline(&list, i, base + (uint32_t)(HostTest_Random64() % span), round * 64U + i));
+        }
+        LIST_TEST_CHECK(count == CheckDeadlineList(&list, order));
+
+        /* The ticks advance in random steps, each step removes the deadlines reached, in list order. */
+        LIST_TEST_CHECK(NULL == LIST_RemoveExpired(&list, base - 1U));
+        removed = 0U;
+        now     = base;
+        while (removed < count)
+        {
+            expired = LIST_RemoveExpired(&list, now);
+            if (NULL != expired)
+            {
+                LIST_TEST_CHECK(&order[removed]->element == expired);
+                LIST_TEST_CHECK((int32_t)(now - expired->deadline) >= 0);
+                LIST_TEST_CHECK(NULL == LIST_GetList(&expired->link));
+                removed++;
+            }
+            else
+            {
+                LIST_TEST_CHECK((int32_t)(now - order[removed]->element.deadline) < 0);
+                now += 1U + (uint32_t)(HostTest_Random64() % ((span / 8U) + 1U));
+            }
+        }
+        LIST_TEST_CHECK(NULL == LIST_RemoveExpired(&list, now));
+        LIST_TEST_CHECK(0U == LIST_GetSize(&list));
+    }
+}
+
+static uint32_t GetModelReadyMask(void)
+{
+    uint32_t mask = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < LIST_TEST_ELEMENT_COUNT; i++)
+    {
+        if (s_priorities[i].queued)
+        {
+            mask |= (1UL << s_priorities[i].priority);
+        }
+    }
+    return mask;
+}
+
+static list_test_priority_t *GetModelHighest(void)
+{
+    list_test_priority_t *highest = NULL;
+    uint32_t i;
+
+    for (i = 0U; i < LIST_TEST_ELEMENT_COUNT; i++)
+    {
+        if (s_priorities[i].queued &&
+            ((NULL == highest) || (s_priorities[i].priority > highest->priority) ||
+             ((s_priorities[i].priority == highest->priority) && (s_priorities[i].sequence < highest->sequence))))
+        {
+            highest = &s_priorities[i];
+        }
+    }
+    return highest;
+}
+
+static list_status_t AddPriority(list_priority_queue_handle_t queue, uint32_t index, uint32_t priority,
+                                 uint32_t sequence)
+{
+    s_priorities[index].priority = priority;
+    s_priorities[index].sequence = sequence;
+    s_priorities[index].queued   = true;
+    return LIST_AddPriority(queue, &s_priorities[index].element, priority);
+}
+
+static void TestPriorityFixed(void)
+{
+    list_priority_queue_t queue;
+
+    (void)memset(s_priorities, 0, sizeof(s_priorities));
+    LIST_InitPriorityQueue(&queue);
+    LIST_TEST_CHECK(0U == queue.readyMask);
+    LIST_TEST_CHECK(NULL == LIST_RemoveHighestPriority(&queue));
+
+    /* First in, first out within a priority, the highest priority first. */
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 0U, 3U, 0U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 1U, 3U, 1U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 2U, 5U, 2U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 3U, 3U, 3U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 4U, 0U, 4U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 5U, GENERIC_LIST_PRIORITY_COUNT - 1U, 5U));
+    LIST_TEST_CHECK(((1UL << (GENERIC_LIST_PRIORITY_COUNT - 1U)) | 0x29U) == queue.readyMask);
+    LIST_TEST_CHECK(&s_priorities[5].element == LIST_RemoveHighestPriority(&queue));
+    LIST_TEST_CHECK(&s_priorities[2].element == LIST_RemoveHighestPriority(&queue));
+    LIST_TEST_CHECK(0x09U == queue.readyMask);
+    LIST_TEST_CHECK(&s_priorities[0].element == LIST_RemoveHighestPriority(&queue));
+    LIST_TEST_CHECK(&s_priorities[1].element == LIST_RemoveHighestPriority(&queue));
+    LIST_TEST_CHECK(&s_priorities[3].element == LIST_RemoveHighestPriority(&queue));
+    LIST_TEST_CHECK(0x01U == queue.readyMask);
+    LIST_TEST_CHECK(&s_priorities[4].element == LIST_RemoveHighestPriority(&queue));
+    LIST_TEST_CHECK(0U == queue.readyMask);
+    LIST_TEST_CHECK(NULL == LIST_RemoveHighestPriority(&queue));
+
+    /* The bit of a priority is cleared with the removal of its last element, from any position. */
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 0U, 2U, 0U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 1U, 2U, 1U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 2U, 2U, 2U));
+    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, 3U, 6U, 3U));
+    LIST_TEST_CHECK(kLIST_Ok == LIST_RemovePriorityElement(&queue, &s_priorities[1].element));
+    LIST_TEST_CHECK(0x44U == queue.readyMask);
+    LIST_TEST_CHECK(kLIST_Ok == LIST_RemovePriorityElement(&queue, &s_priorities[2].element));
+    LIST_TEST_CHECK(0x44U == queue.readyMask);
+    LIST_TEST_CHECK(kLIST_Ok == LIST_RemovePriorityElement(&queue, &s_priorities[0].element));
+    LIST_TEST_CHECK(0x40U == queue.readyMask);
+    LIST_TEST_CHECK(kLIST_OrphanElement == LIST_RemovePriorityElement(&queue, &s_priorities[0].element));
+    LIST_TEST_CHECK(0x40U == queue.readyMask);
+    LIST_TEST_CHECK(kLIST_Ok == LIST_RemovePriorityElement(&queue, &s_priorities[3].element));
+    LIST_TEST_CHECK(0U == queue.readyMask);
+    LIST_TEST_CHECK(NULL == LIST_RemoveHighestPriority(&queue));
+}
+
+static void TestPriorityRandom(void)
+{
+    list_priority_queue_t queue;
+    list_test_priority_t *expected;
+    list_element_handle_t removed;
+    list_status_t status;
+    uint32_t sequence = 0U;
+    uint32_t step;
+    uint32_t index;
+    uint32_t priority;
+    uint64_t random;
+
+    (void)memset(s_priorities, 0, sizeof(s_priorities));
+    LIST_InitPriorityQueue(&queue);
+
+    for (step = 0U; step < LIST_TEST_PRIORITY_STEPS; step++)
+    {
+        random = HostTest_Random64();
+        index  = (uint32_t)((random >> 8U) % LIST_TEST_ELEMENT_COUNT);
+
+        switch (random % 3U)
+        {
+            case 0U:
+                /* A few priorities only, so the buckets hold several elements. */
+                priority = (uint32_t)((random >> 32U) % GENERIC_LIST_PRIORITY_COUNT) & 0x5U;
+                if (!s_priorities[index].queued)
+                {
+                    LIST_TEST_CHECK(kLIST_Ok == AddPriority(&queue, index, priority, sequence++));
+                }
+                break;
+            case 1U:
+                expected = GetModelHighest();
+                removed  = LIST_RemoveHighestPriority(&queue);
+                LIST_TEST_CHECK(((NULL == expected) ? NULL : &expected->element) == removed);
+                if (NULL != expected)
+                {
+                    expected->queued = false;
+                }
+                break;
+            default:
+                status = LIST_RemovePriorityElement(&queue, &s_priorities[index].element);
+                LIST_TEST_CHECK((s_priorities[index].queued ? kLIST_Ok : kLIST_OrphanElement) == status);
+                s_priorities[index].queued = false;
+                break;
+        }
+
+        LIST_TEST_CHECK(GetModelReadyMask() == queue.readyMask);
+    }
+}
+
+int main(void)
+{
+    TestDeadlineWraparound();
+    TestDeadlineRandom();
+    TestPriorityFixed();
+    TestPriorityRandom();
+
+    printf("list_test (GENERIC_LIST_LIGHT %d): %u/%u failed\n", (int)GENERIC_LIST_LIGHT, (unsigned int)s_failCount,
+           (unsigned int)s_caseCount);
+    return (0U == s_failCount) ? 0 : 1;
+}
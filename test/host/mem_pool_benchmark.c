@@ -0,0 +1,110 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Measures the time of an allocation and free pair of fsl_mem_pool, from the
+ * first and from the last size class, with the host C library malloc and free
+ * as the reference. Blocks are held in a window, so the free lists are not
+ * just one block deep.
+ */
+
+#include <stdio.h>
+#include "fsl_mem_pool.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Allocation and free pairs per measurement. */
+#define MEM_POOL_BENCHMARK_ITERATIONS 10000000U
+
+/*! @brief Blocks held at a time, a power of two. */
+#define MEM_POOL_BENCHMARK_WINDOW 8U
+
+/*! @brief Blocks of each size class. */
+#define MEM_POOL_BENCHMARK_BLOCK_COUNT 16U
+
+/*! @brief An allocator under test. */
+typedef void *(*mem_pool_benchmark_alloc_t)(size_t size);
+typedef void (*mem_pool_benchmark_free_t)(void *block);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const mem_pool_class_config_t s_config[] = {
+    {16U, MEM_POOL_BENCHMARK_BLOCK_COUNT},
+    {32U, MEM_POOL_BENCHMARK_BLOCK_COUNT},
+    {64U, MEM_POOL_BENCHMARK_BLOCK_COUNT},
+    {128U, MEM_POOL_BENCHMARK_BLOCK_COUNT},
+};
+
+static MEM_POOL_STORAGE_DEFINE(s_storage,
+                               MEM_POOL_CLASS_SIZE(16U, MEM_POOL_BENCHMARK_BLOCK_COUNT) +
+                                   MEM_POOL_CLASS_SIZE(32U, MEM_POOL_BENCHMARK_BLOCK_COUNT) +
+                                   MEM_POOL_CLASS_SIZE(64U, MEM_POOL_BENCHMARK_BLOCK_COUNT) +
+                                   MEM_POOL_CLASS_SIZE(128U, MEM_POOL_BENCHMARK_BLOCK_COUNT));
+static mem_pool_t s_pool;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void *BenchmarkPoolAlloc(size_t size)
+{
+    return MemPool_Alloc(&s_pool, size);
+}
+
+static void BenchmarkPoolFree(void *block)
+{
+    MemPool_Free(&s_pool, block);
+}
+
+static double MeasurePairs(mem_pool_benchmark_alloc_t allocFunc, mem_pool_benchmark_free_t freeFunc, size_t size)
+{
+    void *window[MEM_POOL_BENCHMARK_WINDOW] = {NULL};
+    uint64_t start;
+    uint32_t i;
+    uint32_t slot;
+
+    start = HostTest_GetTimeNs();
+    for (i = 0U; i < MEM_POOL_BENCHMARK_ITERATIONS; i++)
+    {
+        slot = i & (MEM_POOL_BENCHMARK_WINDOW - 1U);
+        freeFunc(window[slot]);
+        window[slot] = allocFunc(size);
+        /* Touch the block, as a driver state would be. */
+        *(volatile uint8_t *)window[slot] = (uint8_t)i;
+    }
+    for (slot = 0U; slot < MEM_POOL_BENCHMARK_WINDOW; slot++)
+    {
+        freeFunc(window[slot]);
+    }
+    return (double)(HostTest_GetTimeNs() - start) / (double)MEM_POOL_BENCHMARK_ITERATIONS;
+}
+
+int main(void)
+{
+    static const size_t s_sizes[] = {12U, 100U};
+    size_t i;
+
+    if (kStatus_Success != MemPool_Init(&s_pool, s_storage, sizeof(s_storage), s_config, 4U))
+    {
+        printf("MemPool_Init failed\n");
+        return 1;
+    }
+
+    printf("%-6s %14s %14s\n", "size", "mem_pool ns", "malloc ns");
+    for (i = 0U; i < (sizeof(s_sizes) / sizeof(s_sizes[0])); i++)
+    {
+        printf("%-6u %14.1f %14.1f\n", (unsigned int)s_sizes[i],
+               MeasurePairs(BenchmarkPoolAlloc, BenchmarkPoolFree, s_sizes[i]), MeasurePairs(malloc, free, s_sizes[i]));
+    }
+    return 0;
+}
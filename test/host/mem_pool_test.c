@@ -0,0 +1,306 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Unit test of fsl_mem_pool: the configuration checks, the choice of the size
+ * class, the free block counts, and a random allocation sequence checked
+ * against a model of the allocated blocks, with each block filled to catch
+ * overlapping blocks.
+ */
+
+#include <stdio.h>
+#include "fsl_mem_pool.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Block sizes and counts of the test pool. */
+#define MEM_POOL_TEST_SMALL_SIZE   16U
+#define MEM_POOL_TEST_SMALL_COUNT  8U
+#define MEM_POOL_TEST_MEDIUM_SIZE  40U
+#define MEM_POOL_TEST_MEDIUM_COUNT 4U
+#define MEM_POOL_TEST_LARGE_SIZE   130U
+#define MEM_POOL_TEST_LARGE_COUNT  2U
+
+/*! @brief Blocks of the test pool. */
+#define MEM_POOL_TEST_BLOCK_COUNT \
+    (MEM_POOL_TEST_SMALL_COUNT + MEM_POOL_TEST_MEDIUM_COUNT + MEM_POOL_TEST_LARGE_COUNT)
+
+/*! @brief Storage of the test pool. */
+#define MEM_POOL_TEST_STORAGE_SIZE                                                   \
+    (MEM_POOL_CLASS_SIZE(MEM_POOL_TEST_SMALL_SIZE, MEM_POOL_TEST_SMALL_COUNT) +   \
+     MEM_POOL_CLASS_SIZE(MEM_POOL_TEST_MEDIUM_SIZE, MEM_POOL_TEST_MEDIUM_COUNT) + \
+     MEM_POOL_CLASS_SIZE(MEM_POOL_TEST_LARGE_SIZE, MEM_POOL_TEST_LARGE_COUNT))
+
+/*! @brief Steps of the random allocation sequence. */
+#define MEM_POOL_TEST_RANDOM_STEPS 200000U
+
+/*! @brief Checks a condition, counting and reporting the failures. */
+#define MEM_POOL_TEST_CHECK(cond)                                  \
+    do                                                             \
+    {                                                              \
+        s_caseCount++;                                             \
+        if (!(cond))                                               \
+        {                                                          \
+            printf("FAIL line %d: %s\n", __LINE__, #cond);         \
+            s_failCount++;                                         \
+        }                                                          \
+    } while (false)
+
+/*! @brief Block allocated in the random sequence. */
+typedef struct _mem_pool_test_block
+{
+    uint8_t *data; /*!< Block, NULL if the slot is unused. */
+    size_t size;   /*!< Size requested. */
+    uint8_t fill;  /*!< Byte the block is filled with. */
+} mem_pool_test_block_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const mem_pool_class_config_t s_config[] = {
+    {MEM_POOL_TEST_SMALL_SIZE, MEM_POOL_TEST_SMALL_COUNT},
+    {MEM_POOL_TEST_MEDIUM_SIZE, MEM_POOL_TEST_MEDIUM_COUNT},
+    {MEM_POOL_TEST_LARGE_SIZE, MEM_POOL_TEST_LARGE_COUNT},
+};
+
+static MEM_POOL_STORAGE_DEFINE(s_storage, MEM_POOL_TEST_STORAGE_SIZE);
+static mem_pool_t s_pool;
+static uint32_t s_failCount;
+static uint32_t s_caseCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void InitTestPool(void)
+{
+    status_t status = MemPool_Init(&s_pool, s_storage, sizeof(s_storage), s_config, 3U);
+
+    MEM_POOL_TEST_CHECK(kStatus_Success == status);
+}
+
+static uint32_t GetClassIndex(const void *block)
+{
+    uint32_t i;
+
+    for (i = 0U; i < s_pool.classCount; i++)
+    {
+        if (((const uint8_t *)block >= s_pool.classes[i].start) && ((const uint8_t *)block < s_pool.classes[i].end))
+        {
+            return i;
+        }
+    }
+    return s_pool.classCount;
+}
+
+static void TestInit(void)
+{
+    static const mem_pool_class_config_t s_decreasing[] = {{32U, 2U}, {16U, 2U}};
+    static const mem_pool_class_config_t s_tooLarge[]   = {{16U, MEM_POOL_TEST_BLOCK_COUNT * 64U}};
+    mem_pool_t pool;
+    uint32_t i;
+
+    MEM_POOL_TEST_CHECK(kStatus_InvalidArgument == MemPool_Init(&pool, s_storage, sizeof(s_storage), s_config, 0U));
+    MEM_POOL_TEST_CHECK(kStatus_InvalidArgument ==
+                        MemPool_Init(&pool, s_storage, sizeof(s_storage), s_config, MEM_POOL_CLASS_COUNT + 1U));
+    MEM_POOL_TEST_CHECK(kStatus_InvalidArgument ==
+                        MemPool_Init(&pool, (uint8_t *)s_storage + 1U, sizeof(s_storage) - 1U, s_config, 1U));
+    MEM_POOL_TEST_CHECK(kStatus_InvalidArgument ==
+                        MemPool_Init(&pool, s_storage, sizeof(s_storage), s_decreasing, 2U));
+    MEM_POOL_TEST_CHECK(kStatus_InvalidArgument == MemPool_Init(&pool, s_storage, sizeof(s_storage), s_tooLarge, 1U));
+    MEM_POOL_TEST_CHECK(kStatus_InvalidArgument ==
+                        MemPool_Init(&pool, s_storage, MEM_POOL_TEST_STORAGE_SIZE - 1U, s_config, 3U));
+
+    /* The size classes are laid out in order, with the sizes rounded up to the alignment. */
+    InitTestPool();
+    MEM_POOL_TEST_CHECK(3U == s_pool.classCount);
+    MEM_POOL_TEST_CHECK((uint8_t *)s_storage == s_pool.classes[0].start);
+    for (i = 0U; i < s_pool.classCount; i++)
+    {
+        MEM_POOL_TEST_CHECK(0U == (s_pool.classes[i].blockSize % MEM_POOL_BLOCK_ALIGNMENT));
+        MEM_POOL_TEST_CHECK(s_pool.classes[i].blockSize >= s_config[i].blockSize);
+        MEM_POOL_TEST_CHECK(s_config[i].blockCount == s_pool.classes[i].freeCount);
+        MEM_POOL_TEST_CHECK(s_config[i].blockCount == MemPool_GetMinFreeCount(&s_pool, i));
+        if (i > 0U)
+        {
+            MEM_POOL_TEST_CHECK(s_pool.classes[i - 1U].end == s_pool.classes[i].start);
+        }
+    }
+    MEM_POOL_TEST_CHECK(s_pool.classes[2].end <= ((uint8_t *)s_storage + sizeof(s_storage)));
+}
+
+static void TestClassChoice(void)
+{
+    void *small[MEM_POOL_TEST_SMALL_COUNT];
+    void *block;
+    void *medium;
+    uint32_t i;
+
+    InitTestPool();
+
+    /* The first allocation gets the lowest address, the smallest class that fits is used. */
+    block = MemPool_Alloc(&s_pool, 1U);
+    MEM_POOL_TEST_CHECK(block == (void *)s_storage);
+    MemPool_Free(&s_pool, block);
+    MEM_POOL_TEST_CHECK(0U == GetClassIndex(MemPool_Alloc(&s_pool, 0U)));
+    InitTestPool();
+    MEM_POOL_TEST_CHECK(1U == GetClassIndex(MemPool_Alloc(&s_pool, MEM_POOL_TEST_SMALL_SIZE + 1U)));
+    MEM_POOL_TEST_CHECK(2U == GetClassIndex(MemPool_Alloc(&s_pool, MEM_POOL_TEST_LARGE_SIZE)));
+    MEM_POOL_TEST_CHECK(NULL == MemPool_Alloc(&s_pool, s_pool.classes[2].blockSize + 1U));
+
+    /* An exhausted class falls back to the next larger one. */
+    InitTestPool();
+    for (i = 0U; i < MEM_POOL_TEST_SMALL_COUNT; i++)
+    {
+        small[i] = MemPool_Alloc(&s_pool, MEM_POOL_TEST_SMALL_SIZE);
+        MEM_POOL_TEST_CHECK(0U == GetClassIndex(small[i]));
+    }
+    MEM_POOL_TEST_CHECK(0U == s_pool.classes[0].freeCount);
+    MEM_POOL_TEST_CHECK(0U == MemPool_GetMinFreeCount(&s_pool, 0U));
+    medium = MemPool_Alloc(&s_pool, 1U);
+    MEM_POOL_TEST_CHECK(1U == GetClassIndex(medium));
+
+    /* A freed block goes back to its class and is reused first, the low water mark stays. */
+    MemPool_Free(&s_pool, small[3]);
+    MEM_POOL_TEST_CHECK(1U == s_pool.classes[0].freeCount);
+    MEM_POOL_TEST_CHECK(0U == MemPool_GetMinFreeCount(&s_pool, 0U));
+    MEM_POOL_TEST_CHECK(small[3] == MemPool_Alloc(&s_pool, 1U));
+    MemPool_Free(&s_pool, medium);
+    MEM_POOL_TEST_CHECK(MEM_POOL_TEST_MEDIUM_COUNT == s_pool.classes[1].freeCount);
+    MEM_POOL_TEST_CHECK((MEM_POOL_TEST_MEDIUM_COUNT - 1U) == MemPool_GetMinFreeCount(&s_pool, 1U));
+
+    /* Freeing NULL does nothing. */
+    MemPool_Free(&s_pool, NULL);
+    MEM_POOL_TEST_CHECK(MEM_POOL_TEST_MEDIUM_COUNT == s_pool.classes[1].freeCount);
+
+    /* Everything allocated, then nothing is left. */
+    InitTestPool();
+    for (i = 0U; i < MEM_POOL_TEST_BLOCK_COUNT; i++)
+    {
+        MEM_POOL_TEST_CHECK(NULL != MemPool_Alloc(&s_pool, 1U));
+    }
+    MEM_POOL_TEST_CHECK(NULL == MemPool_Alloc(&s_pool, 1U));
+}
+
+static bool CheckFill(const mem_pool_test_block_t *block)
+{
+    size_t i;
+
+    for (i = 0U; i < block->size; i++)
+    {
+        if (block->fill != block->data[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void TestRandomSequence(void)
+{
+    mem_pool_test_block_t blocks[MEM_POOL_TEST_BLOCK_COUNT + 1U];
+    uint32_t freeCount[3];
+    uint32_t minFreeCount[3];
+    uint32_t step;
+    uint32_t slot;
+    uint32_t classIndex;
+    uint32_t i;
+    uint64_t random;
+    size_t size;
+    bool expectBlock;
+
+    InitTestPool();
+    (void)memset(blocks, 0, sizeof(blocks));
+    for (i = 0U; i < 3U; i++)
+    {
+        freeCount[i]    = s_config[i].blockCount;
+        minFreeCount[i] = s_config[i].blockCount;
+    }
+
+    for (step = 0U; step < MEM_POOL_TEST_RANDOM_STEPS; step++)
+    {
+        random = HostTest_Random64();
+        slot   = (uint32_t)(random % (MEM_POOL_TEST_BLOCK_COUNT + 1U));
+
+        if (NULL != blocks[slot].data)
+        {
+            MEM_POOL_TEST_CHECK(CheckFill(&blocks[slot]));
+            classIndex = GetClassIndex(blocks[slot].data);
+            MemPool_Free(&s_pool, blocks[slot].data);
+            freeCount[classIndex]++;
+            blocks[slot].data = NULL;
+        }
+        else
+        {
+            size = (size_t)((random >> 32U) % (s_pool.classes[2].blockSize + 1U));
+
+            /* The model: the first class that fits the size and has a free block. */
+            expectBlock = false;
+            for (i = 0U; i < 3U; i++)
+            {
+                if ((size <= s_pool.classes[i].blockSize) && (0U != freeCount[i]))
+                {
+                    expectBlock = true;
+                    break;
+                }
+            }
+
+            blocks[slot].data = (uint8_t *)MemPool_Alloc(&s_pool, size);
+            if (expectBlock)
+            {
+                classIndex = GetClassIndex(blocks[slot].data);
+                MEM_POOL_TEST_CHECK(i == classIndex);
+                if (NULL == blocks[slot].data)
+                {
+                    continue;
+                }
+                MEM_POOL_TEST_CHECK(0U ==
+                                    ((blocks[slot].data - s_pool.classes[i].start) % s_pool.classes[i].blockSize));
+                freeCount[i]--;
+                minFreeCount[i] = MIN(minFreeCount[i], freeCount[i]);
+                blocks[slot].size = size;
+                blocks[slot].fill = (uint8_t)(step + 1U);
+                (void)memset(blocks[slot].data, blocks[slot].fill, size);
+            }
+            else
+            {
+                MEM_POOL_TEST_CHECK(NULL == blocks[slot].data);
+                blocks[slot].data = NULL;
+            }
+        }
+
+        for (i = 0U; i < 3U; i++)
+        {
+            MEM_POOL_TEST_CHECK(freeCount[i] == s_pool.classes[i].freeCount);
+            MEM_POOL_TEST_CHECK(minFreeCount[i] == MemPool_GetMinFreeCount(&s_pool, i));
+        }
+    }
+
+    /* No block was overwritten through another one. */
+    for (slot = 0U; slot <= MEM_POOL_TEST_BLOCK_COUNT; slot++)
+    {
+        if (NULL != blocks[slot].data)
+        {
+            MEM_POOL_TEST_CHECK(CheckFill(&blocks[slot]));
+        }
+    }
+}
+
+int main(void)
+{
+    TestInit();
+    TestClassChoice();
+    TestRandomSequence();
+
+    printf("mem_pool_test: %u/%u failed\n", (unsigned int)s_failCount, (unsigned int)s_caseCount);
+    return (0U == s_failCount) ? 0 : 1;
+}
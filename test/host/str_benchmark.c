@@ -0,0 +1,190 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Measures the time per converted field of StrFormatPrintf, with the host C
+ * library snprintf as the reference. StrFormatPrintf is called directly with a
+ * bounded buffer callback, so the benchmark also builds against older
+ * revisions of fsl_str.c for before/after comparisons.
+ */
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include "fsl_str.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Fields converted per measurement. */
+#define STR_BENCHMARK_ITERATIONS 1000000U
+
+/*! @brief Number of distinct arguments, cycled through to defeat branch prediction on one value. */
+#define STR_BENCHMARK_VALUES 1024U
+
+/*! @brief Size of the output buffer. */
+#define STR_BENCHMARK_BUFFER_SIZE 128U
+
+/*! @brief A formatter with the snprintf signature. */
+typedef int (*str_benchmark_format_t)(char *buf, size_t size, const char *fmt, ...);
+
+/*! @brief Kind of argument a benchmark case takes. */
+typedef enum _str_benchmark_arg
+{
+    kSTR_BenchmarkInt = 0U,   /*!< int */
+    kSTR_BenchmarkLongLong,   /*!< long long int */
+    kSTR_BenchmarkPointer,    /*!< void * */
+    kSTR_BenchmarkString,     /*!< const char * */
+    kSTR_BenchmarkDouble,     /*!< double */
+    kSTR_BenchmarkWideDouble, /*!< double of any magnitude from 1e-60 to 1e100 */
+} str_benchmark_arg_t;
+
+/*! @brief One benchmark case. */
+typedef struct _str_benchmark_case
+{
+    const char *fmt;         /*!< Format of the field. */
+    str_benchmark_arg_t arg; /*!< Kind of argument. */
+} str_benchmark_case_t;
+
+/*! @brief Output buffer of the StrFormatPrintf callback. */
+typedef struct _str_benchmark_buffer
+{
+    char *data;  /*!< Buffer to store the output. */
+    size_t size; /*!< Size of the buffer. */
+} str_benchmark_buffer_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const str_benchmark_case_t s_cases[] = {
+    {"%d", kSTR_BenchmarkInt},
+    {"%8d", kSTR_BenchmarkInt},
+    {"%x", kSTR_BenchmarkInt},
+    {"%08X", kSTR_BenchmarkInt},
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    {"%lld", kSTR_BenchmarkLongLong},
+    {"%llx", kSTR_BenchmarkLongLong},
+#endif /* PRINTF_ADVANCED_ENABLE */
+    {"%p", kSTR_BenchmarkPointer},
+    {"%s", kSTR_BenchmarkString},
+    {"%-12s", kSTR_BenchmarkString},
+#if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
+    {"%f", kSTR_BenchmarkDouble},
+    {"%.2f", kSTR_BenchmarkDouble},
+    {"%.9f", kSTR_BenchmarkDouble},
+    {"%.17f", kSTR_BenchmarkDouble},
+    {"%.3f", kSTR_BenchmarkWideDouble},
+#endif /* PRINTF_FLOAT_ENABLE */
+};
+
+static const char *const s_strings[] = {"ok", "timeout", "DeepSleep", "Power mode switch"};
+static int s_ints[STR_BENCHMARK_VALUES];
+static long long int s_longLongs[STR_BENCHMARK_VALUES];
+static double s_doubles[STR_BENCHMARK_VALUES];
+static double s_wideDoubles[STR_BENCHMARK_VALUES];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void BenchmarkPutChar(char *buf, int32_t *indicator, char val, int len)
+{
+    str_benchmark_buffer_t *output = (str_benchmark_buffer_t *)(void *)buf;
+    int i;
+
+    for (i = 0; i < len; i++)
+    {
+        if (((size_t)*indicator + 1U) < output->size)
+        {
+            output->data[*indicator] = val;
+        }
+        (*indicator)++;
+    }
+}
+
+static int BenchmarkStrFormat(char *buf, size_t size, const char *fmt, ...)
+{
+    str_benchmark_buffer_t output;
+    va_list ap;
+    int count;
+
+    output.data = buf;
+    output.size = size;
+    va_start(ap, fmt);
+    count = StrFormatPrintf(fmt, ap, (char *)&output, BenchmarkPutChar);
+    va_end(ap);
+    buf[MIN((size_t)count, size - 1U)] = '\0';
+    return count;
+}
+
+static double MeasureCase(str_benchmark_format_t format, const str_benchmark_case_t *benchCase)
+{
+    char out[STR_BENCHMARK_BUFFER_SIZE];
+    uint64_t start;
+    uint32_t i;
+    uint32_t n;
+    volatile int sink = 0;
+
+    start = HostTest_GetTimeNs();
+    for (i = 0U; i < STR_BENCHMARK_ITERATIONS; i++)
+    {
+        n = i % STR_BENCHMARK_VALUES;
+        switch (benchCase->arg)
+        {
+            case kSTR_BenchmarkInt:
+                sink += format(out, sizeof(out), benchCase->fmt, s_ints[n]);
+                break;
+            case kSTR_BenchmarkLongLong:
+                sink += format(out, sizeof(out), benchCase->fmt, s_longLongs[n]);
+                break;
+            case kSTR_BenchmarkPointer:
+                sink += format(out, sizeof(out), benchCase->fmt, (void *)&s_ints[n]);
+                break;
+            case kSTR_BenchmarkString:
+                sink += format(out, sizeof(out), benchCase->fmt,
+                               s_strings[n % (sizeof(s_strings) / sizeof(s_strings[0]))]);
+                break;
+            case kSTR_BenchmarkWideDouble:
+                sink += format(out, sizeof(out), benchCase->fmt, s_wideDoubles[n]);
+                break;
+            case kSTR_BenchmarkDouble:
+            default:
+                sink += format(out, sizeof(out), benchCase->fmt, s_doubles[n]);
+                break;
+        }
+    }
+    (void)sink;
+    return (double)(HostTest_GetTimeNs() - start) / (double)STR_BENCHMARK_ITERATIONS;
+}
+
+int main(void)
+{
+    size_t i;
+
+    for (i = 0U; i < STR_BENCHMARK_VALUES; i++)
+    {
+        /* Counters and register values: mostly small, some full width. */
+        s_ints[i]      = (int)(uint32_t)(HostTest_Random64() >> (32U + (i % 28U)));
+        s_longLongs[i] = (long long int)(HostTest_Random64() >> (i % 48U));
+        /* Sensor-like readings, a few thousand with some fraction bits. */
+        s_doubles[i] = (double)(int64_t)(HostTest_Random64() % 20000000U) / 4096.0 - 2000.0;
+        /* Values far from one, which take the long paths of the float conversion. */
+        s_wideDoubles[i] = s_doubles[i] * pow(10.0, (double)(int32_t)(HostTest_Random64() % 160U) - 63.0);
+    }
+
+    printf("%-8s %14s %14s\n", "field", "fsl_str ns", "libc ns");
+    for (i = 0U; i < (sizeof(s_cases) / sizeof(s_cases[0])); i++)
+    {
+        printf("%-8s %14.1f %14.1f\n", s_cases[i].fmt, MeasureCase(BenchmarkStrFormat, &s_cases[i]),
+               MeasureCase(snprintf, &s_cases[i]));
+    }
+    return 0;
+}
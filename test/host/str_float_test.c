@@ -0,0 +1,231 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Compares the %f conversion of StrFormatPrintf with the host C library, which
+ * prints the exact decimal value of a double rounded half to even. Without
+ * PRINTF_FLOAT_EXACT_ENABLE the values of 2^64 and above, and the values with
+ * fraction bits below 2^-96, are checked against the error bound instead.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_str.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Largest output of a test case, %.1100f of the smallest subnormal. */
+#define STR_FLOAT_TEST_BUFFER_SIZE 1200U
+
+/*! @brief Random doubles checked at each precision. */
+#define STR_FLOAT_TEST_RANDOM_COUNT 50000U
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_mismatchCount;
+static uint32_t s_caseCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+#if !(defined(PRINTF_FLOAT_EXACT_ENABLE) && (PRINTF_FLOAT_EXACT_ENABLE > 0U))
+static bool IsExactValue(double value)
+{
+    double scaled;
+
+    if (!isfinite(value))
+    {
+        return true;
+    }
+    value = fabs(value);
+    if (value >= 0x1p64)
+    {
+        return false;
+    }
+    scaled = ldexp(value, 96);
+    return (scaled == floor(scaled));
+}
+
+static bool IsWithinBound(const char *fmt, const char *actual, double value)
+{
+    const char *dot = strchr(fmt, '.');
+    int precision   = (NULL != dot) ? atoi(dot + 1) : 6;
+    double bound;
+
+    /* Half a unit of the last digit, the dropped fraction bits, the scaling and strtod roundings. */
+    bound = (0.5 * pow(10.0, -precision)) + 0x1p-96 + (fabs(value) * 0x1p-51);
+    return (fabs(strtod(actual, NULL) - value) <= bound);
+}
+#endif /* PRINTF_FLOAT_EXACT_ENABLE */
+
+static void CheckFormat(const char *fmt, double value)
+{
+    static char expected[STR_FLOAT_TEST_BUFFER_SIZE];
+    static char actual[STR_FLOAT_TEST_BUFFER_SIZE];
+    int expectedLen;
+    int actualLen;
+    bool match;
+
+    expectedLen = snprintf(expected, sizeof(expected), fmt, value);
+    actualLen   = StrFormatSnprintf(actual, sizeof(actual), fmt, value);
+    s_caseCount++;
+    match = (expectedLen == actualLen) && (0 == strcmp(expected, actual));
+#if !(defined(PRINTF_FLOAT_EXACT_ENABLE) && (PRINTF_FLOAT_EXACT_ENABLE > 0U))
+    if (!IsExactValue(value))
+    {
+        match = (expectedLen == actualLen) && IsWithinBound(fmt, actual, value);
+    }
+#endif /* PRINTF_FLOAT_EXACT_ENABLE */
+    if (!match)
+    {
+        if (s_mismatchCount < 20U)
+        {
+            printf("FAIL \"%s\" of %a: got \"%s\" (%d), expected \"%s\" (%d)\n", fmt, value, actual, actualLen,
+                   expected, expectedLen);
+        }
+        s_mismatchCount++;
+    }
+}
+
+static void CheckPrecisions(double value, uint32_t maxPrecision)
+{
+    char fmt[16];
+    uint32_t precision;
+
+    for (precision = 0U; precision <= maxPrecision; precision++)
+    {
+        (void)snprintf(fmt, sizeof(fmt), "%%.%uf", (unsigned int)precision);
+        CheckFormat(fmt, value);
+    }
+    CheckFormat("%f", value);
+}
+
+static void TestReviewCases(void)
+{
+    CheckFormat("%.2f", 123456789.0);
+    CheckFormat("%f", 16777217.0);
+    CheckFormat("%.12f", 1.5);
+    CheckFormat("%f", 1e20);
+    CheckFormat("%f", 1.0 / 3.0);
+    CheckFormat("%.20f", 0.1);
+    CheckFormat("%.60f", 0.1);
+}
+
+static void TestSpecialValues(void)
+{
+    static const double s_values[] = {0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.375, 9.5, 99.5, 0.95, 0.995,
+                                      9.9999999, 0.9999999, 999999.9999999, 4294967295.5, 4294967296.0,
+                                      9007199254740991.0, 9007199254740993.0, 18446744073709551616.0, 1e22,
+                                      1e23, 1e300, DBL_MAX, DBL_MIN, 0x1p-1074, DBL_EPSILON};
+    size_t i;
+
+    for (i = 0U; i < (sizeof(s_values) / sizeof(s_values[0])); i++)
+    {
+        CheckPrecisions(s_values[i], 25U);
+        CheckPrecisions(-s_values[i], 3U);
+    }
+    CheckFormat("%.1100f", 0x1p-1074);
+    CheckFormat("%.1080f", DBL_MIN);
+    CheckFormat("%f", INFINITY);
+    CheckFormat("%f", -INFINITY);
+    CheckFormat("%F", INFINITY);
+    CheckFormat("%f", NAN);
+    CheckFormat("%F", -NAN);
+}
+
+static void TestFlagsAndWidth(void)
+{
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    static const char *const s_formats[] = {"%12.3f", "%-12.3f|", "%012.3f", "%+.2f", "% .2f", "%+012.1f",
+                                            "%-+12.1f|", "%#.0f", "%#8.0f", "%-012.3f|", "%08f", "%3.1f",
+                                            "%*.*f"};
+    static const double s_values[] = {0.0, -0.0, 3.14159, -3.14159, 99.95, -1e10, 12345678.875, INFINITY, -NAN};
+    size_t i;
+    size_t j;
+
+    for (i = 0U; i < (sizeof(s_formats) / sizeof(s_formats[0])); i++)
+    {
+        for (j = 0U; j < (sizeof(s_values) / sizeof(s_values[0])); j++)
+        {
+            if (0 == strcmp(s_formats[i], "%*.*f"))
+            {
+                char expected[64];
+                char actual[64];
+
+                (void)snprintf(expected, sizeof(expected), s_formats[i], 15, 4, s_values[j]);
+                (void)StrFormatSnprintf(actual, sizeof(actual), s_formats[i], 15, 4, s_values[j]);
+                s_caseCount++;
+                if (0 != strcmp(expected, actual))
+                {
+                    printf("FAIL \"%%*.*f\": got \"%s\", expected \"%s\"\n", actual, expected);
+                    s_mismatchCount++;
+                }
+            }
+            else
+            {
+                CheckFormat(s_formats[i], s_values[j]);
+            }
+        }
+    }
+#else
+    CheckFormat("%12.3f", -3.14159);
+    CheckFormat("%3.1f", 99.95);
+#endif /* PRINTF_ADVANCED_ENABLE */
+}
+
+static void TestRandomValues(void)
+{
+    uint64_t bits;
+    double value;
+    uint32_t i;
+
+    for (i = 0U; i < STR_FLOAT_TEST_RANDOM_COUNT; i++)
+    {
+        /* Any finite double, and values around one which use all the fraction digits. */
+        bits = HostTest_Random64();
+        if (0U != (i & 1U))
+        {
+            bits = (bits & 0x800FFFFFFFFFFFFFULL) | ((uint64_t)(1023U - 40U + (uint32_t)(bits >> 52U) % 80U) << 52U);
+        }
+        (void)memcpy(&value, &bits, sizeof(value));
+        if (!isfinite(value))
+        {
+            continue;
+        }
+        CheckPrecisions(value, ((i % 16U) == 0U) ? 40U : 17U);
+    }
+
+    /* Values with a few fraction bits, where the digits end early and ties are common. */
+    for (i = 0U; i < STR_FLOAT_TEST_RANDOM_COUNT; i++)
+    {
+        value = (double)(HostTest_Random64() % 100000000U) / (double)(1U << (i % 12U));
+        CheckPrecisions(value, 12U);
+    }
+}
+
+int main(void)
+{
+    TestReviewCases();
+    TestSpecialValues();
+    TestFlagsAndWidth();
+    TestRandomValues();
+
+    printf("str_float_test: %u/%u mismatches\n", (unsigned int)s_mismatchCount, (unsigned int)s_caseCount);
+    return (0U == s_mismatchCount) ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Fuzz target comparing StrFormatSnprintf with the host C library.
+ *
+ * Each input is decoded into a sequence of conversions, with flags, width,
+ * precision and argument taken from the input bytes, and every conversion is
+ * formatted by both implementations. Only conversions whose behavior is
+ * defined by the C standard and supported by fsl_str are generated:
+ * - '#' is used with x, X and f only, '+' and ' ' with signed conversions only.
+ * - Integer conversions take no precision, fsl_str does not implement it.
+ * - %s and %c take no '0' flag, %s no NULL pointer and %p no NULL pointer.
+ *
+ * Built with -fsanitize=fuzzer (STR_FUZZ_LIBFUZZER) the file is a libFuzzer
+ * target. Otherwise it has a main() which runs a fixed number of random
+ * inputs, or the files given on the command line, e.g. an AFL queue.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "fsl_str.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Random inputs of the standalone driver. */
+#ifndef STR_FUZZ_RANDOM_INPUTS
+#define STR_FUZZ_RANDOM_INPUTS 200000U
+#endif
+
+/*! @brief Size of one random input of the standalone driver. */
+#define STR_FUZZ_INPUT_SIZE 64U
+
+/*! @brief Output buffer size, larger than any generated conversion. */
+#define STR_FUZZ_BUFFER_SIZE 512U
+
+/*! @brief Cursor over the fuzz input, reading zeros once it is used up. */
+typedef struct _str_fuzz_input
+{
+    const uint8_t *data; /*!< Input bytes. */
+    size_t size;         /*!< Bytes left. */
+} str_fuzz_input_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const char s_conversions[] = "diuxXocsfFp";
+static const char *const s_strings[] = {"", "a", "fsl_str", "0123456789abcdef", " spaces  "};
+static uint32_t s_mismatchCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint8_t FuzzGetByte(str_fuzz_input_t *input)
+{
+    uint8_t byte = 0U;
+
+    if (input->size > 0U)
+    {
+        byte = *input->data++;
+        input->size--;
+    }
+    return byte;
+}
+
+static uint64_t FuzzGetBytes(str_fuzz_input_t *input, uint32_t count)
+{
+    uint64_t value = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        value = (value << 8U) | FuzzGetByte(input);
+    }
+    return value;
+}
+
+static void FuzzCompare(const char *fmt, const char *expected, int expectedLen, const char *actual, int actualLen)
+{
+    if ((expectedLen != actualLen) || (0 != strcmp(expected, actual)))
+    {
+        if (s_mismatchCount < 20U)
+        {
+            printf("FAIL \"%s\": got \"%s\" (%d), expected \"%s\" (%d)\n", fmt, actual, actualLen, expected,
+                   expectedLen);
+        }
+        s_mismatchCount++;
+#if (defined(STR_FUZZ_LIBFUZZER) && (STR_FUZZ_LIBFUZZER > 0U))
+        /* libFuzzer keeps the input which made the target crash. */
+        (void)fflush(stdout);
+        abort();
+#endif /* STR_FUZZ_LIBFUZZER */
+    }
+}
+
+static void FuzzOneConversion(str_fuzz_input_t *input)
+{
+    char expected[STR_FUZZ_BUFFER_SIZE];
+    char actual[STR_FUZZ_BUFFER_SIZE];
+    char fmt[32];
+    size_t len = 0U;
+    uint8_t ctrl;
+    uint8_t flags;
+    char conv;
+    bool isSigned;
+    bool isInt;
+    bool longLong;
+    int expectedLen;
+    int actualLen;
+
+    ctrl     = FuzzGetByte(input);
+    flags    = FuzzGetByte(input);
+    conv     = s_conversions[ctrl % (sizeof(s_conversions) - 1U)];
+    isSigned = (('d' == conv) || ('i' == conv) || ('f' == conv) || ('F' == conv));
+    isInt    = (NULL != strchr("diuxXo", conv));
+    longLong = isInt && (0U != (ctrl & 0x80U));
+
+    fmt[len++] = '%';
+    if (0U != (flags & 0x01U))
+    {
+        fmt[len++] = '-';
+    }
+    if ((0U != (flags & 0x02U)) && isSigned)
+    {
+        fmt[len++] = '+';
+    }
+    if ((0U != (flags & 0x04U)) && isSigned)
+    {
+        fmt[len++] = ' ';
+    }
+    if ((0U != (flags & 0x08U)) && ('s' != conv) && ('c' != conv) && ('p' != conv))
+    {
+        fmt[len++] = '0';
+    }
+    if ((0U != (flags & 0x10U)) && (NULL != strchr("xXfF", conv)))
+    {
+        fmt[len++] = '#';
+    }
+    if (0U != (flags & 0x20U))
+    {
+        len += (size_t)snprintf(&fmt[len], sizeof(fmt) - len, "%u", (unsigned int)(FuzzGetByte(input) % 40U));
+    }
+    if ((0U != (flags & 0x40U)) && !isInt && ('c' != conv) && ('p' != conv))
+    {
+        len += (size_t)snprintf(&fmt[len], sizeof(fmt) - len, ".%u", (unsigned int)(FuzzGetByte(input) % 30U));
+    }
+    if (longLong)
+    {
+        fmt[len++] = 'l';
+        fmt[len++] = 'l';
+    }
+    fmt[len++] = conv;
+    fmt[len]   = '\0';
+
+    switch (conv)
+    {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            if (longLong)
+            {
+                long long int value = (long long int)FuzzGetBytes(input, 8U);
+                expectedLen         = snprintf(expected, sizeof(expected), fmt, value);
+                actualLen           = StrFormatSnprintf(actual, sizeof(actual), fmt, value);
+            }
+            else
+            {
+                int value   = (int)(uint32_t)FuzzGetBytes(input, 4U);
+                expectedLen = snprintf(expected, sizeof(expected), fmt, value);
+                actualLen   = StrFormatSnprintf(actual, sizeof(actual), fmt, value);
+            }
+            break;
+        case 'c':
+        {
+            int value   = (int)(FuzzGetByte(input) % 95U) + (int)' ';
+            expectedLen = snprintf(expected, sizeof(expected), fmt, value);
+            actualLen   = StrFormatSnprintf(actual, sizeof(actual), fmt, value);
+            break;
+        }
+        case 's':
+        {
+            const char *value = s_strings[FuzzGetByte(input) % (sizeof(s_strings) / sizeof(s_strings[0]))];
+            expectedLen       = snprintf(expected, sizeof(expected), fmt, value);
+            actualLen         = StrFormatSnprintf(actual, sizeof(actual), fmt, value);
+            break;
+        }
+        case 'p':
+        {
+            void *value = (void *)(uintptr_t)(FuzzGetBytes(input, sizeof(void *)) | 1U);
+            expectedLen = snprintf(expected, sizeof(expected), fmt, value);
+            actualLen   = StrFormatSnprintf(actual, sizeof(actual), fmt, value);
+            break;
+        }
+        default:
+        {
+            /* Any bit pattern, NaN payloads and signs included. */
+            uint64_t bits = FuzzGetBytes(input, 8U);
+            double value;
+            (void)memcpy(&value, &bits, sizeof(value));
+            expectedLen = snprintf(expected, sizeof(expected), fmt, value);
+            actualLen   = StrFormatSnprintf(actual, sizeof(actual), fmt, value);
+            break;
+        }
+    }
+
+    /* Large doubles do not fit the buffer, the length must still match and the output be cut the same way. */
+    FuzzCompare(fmt, expected, expectedLen, actual, actualLen);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    str_fuzz_input_t input;
+
+    input.data = data;
+    input.size = size;
+    do
+    {
+        FuzzOneConversion(&input);
+    } while (input.size > 0U);
+
+    return 0;
+}
+
+#if !(defined(STR_FUZZ_LIBFUZZER) && (STR_FUZZ_LIBFUZZER > 0U))
+static void FuzzRunFile(const char *path)
+{
+    static uint8_t s_data[4096];
+    FILE *file = fopen(path, "rb");
+    size_t size;
+
+    if (NULL == file)
+    {
+        printf("cannot open %s\n", path);
+        s_mismatchCount++;
+        return;
+    }
+    size = fread(s_data, 1U, sizeof(s_data), file);
+    (void)fclose(file);
+    (void)LLVMFuzzerTestOneInput(s_data, size);
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t data[STR_FUZZ_INPUT_SIZE];
+    uint64_t random;
+    uint32_t i;
+    uint32_t j;
+    int arg;
+
+    if (argc > 1)
+    {
+        for (arg = 1; arg < argc; arg++)
+        {
+            FuzzRunFile(argv[arg]);
+        }
+    }
+    else
+    {
+        for (i = 0U; i < STR_FUZZ_RANDOM_INPUTS; i++)
+        {
+            for (j = 0U; j < STR_FUZZ_INPUT_SIZE; j += 8U)
+            {
+                random = HostTest_Random64();
+                (void)memcpy(&data[j], &random, sizeof(random));
+            }
+            (void)LLVMFuzzerTestOneInput(data, sizeof(data));
+        }
+    }
+    printf("str_fuzz: %u mismatches\n", (unsigned int)s_mismatchCount);
+    return (0U == s_mismatchCount) ? 0 : 1;
+}
+#endif /* STR_FUZZ_LIBFUZZER */
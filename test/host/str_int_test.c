@@ -0,0 +1,180 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Compares the integer, pointer, character and string conversions of
+ * StrFormatPrintf with the host C library. Without PRINTF_ADVANCED_ENABLE
+ * signed values are printed as unsigned and pointers are truncated to 32 bits,
+ * so that build only checks non-negative values and small pointers.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "fsl_str.h"
+#include "host_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Random values checked with every flag and width combination. */
+#define STR_INT_TEST_RANDOM_COUNT 20000U
+
+/*! @brief Compares one conversion with the C library. */
+#define STR_INT_TEST_CHECK(fmt, ...)                                                        \
+    do                                                                                      \
+    {                                                                                       \
+        char expected_[128];                                                                \
+        char actual_[128];                                                                  \
+        int expectedLen_ = snprintf(expected_, sizeof(expected_), (fmt), __VA_ARGS__);      \
+        int actualLen_   = StrFormatSnprintf(actual_, sizeof(actual_), (fmt), __VA_ARGS__); \
+        CheckResult((fmt), expected_, expectedLen_, actual_, actualLen_);                   \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_mismatchCount;
+static uint32_t s_caseCount;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void CheckResult(const char *fmt, const char *expected, int expectedLen, const char *actual, int actualLen)
+{
+    s_caseCount++;
+    if ((expectedLen != actualLen) || (0 != strcmp(expected, actual)))
+    {
+        if (s_mismatchCount < 20U)
+        {
+            printf("FAIL \"%s\": got \"%s\" (%d), expected \"%s\" (%d)\n", fmt, actual, actualLen, expected,
+                   expectedLen);
+        }
+        s_mismatchCount++;
+    }
+}
+
+static void TestFixedCases(void)
+{
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    int local;
+#endif /* PRINTF_ADVANCED_ENABLE */
+
+    STR_INT_TEST_CHECK("%s|%c|%%|%5s|", "ab", 'z', "xy");
+    STR_INT_TEST_CHECK("%5c|%1c|", 'z', 'y');
+    STR_INT_TEST_CHECK("%d %u %x %X %o", 0, 0U, 0U, 0U, 0U);
+    STR_INT_TEST_CHECK("%d %u", 2147483647, 4294967295U);
+    STR_INT_TEST_CHECK("%x %X", 0xDEADBEEFU, 0xDEADBEEFU);
+    STR_INT_TEST_CHECK("%p", (void *)0x1234);
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    STR_INT_TEST_CHECK("%d", -2147483647 - 1);
+    STR_INT_TEST_CHECK("%p", (void *)&local);
+    STR_INT_TEST_CHECK("%#x %#X", 0U, 0U);
+    STR_INT_TEST_CHECK("%#x %#X", 255U, 255U);
+    STR_INT_TEST_CHECK("%#8x|%-#8x|%#08x", 0U, 0U, 0U);
+    STR_INT_TEST_CHECK("%lld %llu", -9223372036854775807LL - 1LL, 18446744073709551615ULL);
+    STR_INT_TEST_CHECK("%llx %llX", 0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL);
+    STR_INT_TEST_CHECK("%20p|%-20p|", (void *)&local, (void *)&local);
+    STR_INT_TEST_CHECK("%.2s|%8.3s|%-8.1s|", "abc", "abcdef", "xyz");
+    STR_INT_TEST_CHECK("%8.5s|%-8.5s|%.5s|", "ab", "ab", "");
+    STR_INT_TEST_CHECK("%-5c|%c", 'z', 'y');
+    STR_INT_TEST_CHECK("%*d|%-*d|", 6, 42, 6, 42);
+    STR_INT_TEST_CHECK("%hhd %hd %ld %zu", 7, 300, -5L, (size_t)99U);
+#endif /* PRINTF_ADVANCED_ENABLE */
+}
+
+static void TestRandomValues(void)
+{
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    static const char *const s_flags[] = {"", "-", "+", " ", "0", "#", "-+", "0+", "-#", "0#", "-0", "-0#"};
+#else
+    static const char *const s_flags[] = {""};
+#endif /* PRINTF_ADVANCED_ENABLE */
+    static const char *const s_widths[] = {"", "1", "5", "12", "24"};
+    char fmt[32];
+    long long int value;
+    uint32_t i;
+    size_t flag;
+    size_t width;
+    bool hasSign;
+    bool hasPound;
+
+    for (i = 0U; i < STR_INT_TEST_RANDOM_COUNT; i++)
+    {
+        value = (long long int)HostTest_Random64();
+        /* Mix in small magnitudes, which have few digits. */
+        if (0U == (i % 3U))
+        {
+            value >>= (i % 60U);
+        }
+        if (0U == (i % 17U))
+        {
+            value = 0;
+        }
+#if !(defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+        value &= 0x7FFFFFFFLL;
+#endif /* PRINTF_ADVANCED_ENABLE */
+
+        for (flag = 0U; flag < (sizeof(s_flags) / sizeof(s_flags[0])); flag++)
+        {
+            hasSign  = (NULL != strchr(s_flags[flag], '+')) || (NULL != strchr(s_flags[flag], ' '));
+            hasPound = (NULL != strchr(s_flags[flag], '#'));
+            for (width = 0U; width < (sizeof(s_widths) / sizeof(s_widths[0])); width++)
+            {
+                /* '#' is only defined for x, X and o, '+' and ' ' only for signed conversions. */
+                if (!hasPound)
+                {
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%sd", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, (int)value);
+                }
+                if (!hasSign)
+                {
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%sx", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, (unsigned int)value);
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%sX", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, (unsigned int)value);
+                }
+                if (!hasSign && !hasPound)
+                {
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%su", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, (unsigned int)value);
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%so", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, (unsigned int)value);
+                }
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+                if (!hasPound)
+                {
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%slld", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, value);
+                }
+                if (!hasSign)
+                {
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%sllx", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, (unsigned long long int)value);
+                }
+                if (!hasSign && !hasPound)
+                {
+                    (void)snprintf(fmt, sizeof(fmt), "%%%s%sllu", s_flags[flag], s_widths[width]);
+                    STR_INT_TEST_CHECK(fmt, (unsigned long long int)value);
+                }
+#endif /* PRINTF_ADVANCED_ENABLE */
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    TestFixedCases();
+    TestRandomValues();
+
+    printf("str_int_test: %u/%u mismatches\n", (unsigned int)s_mismatchCount, (unsigned int)s_caseCount);
+    return (0U == s_mismatchCount) ? 0 : 1;
+}
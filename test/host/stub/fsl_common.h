@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+/*
+ * Host replacement of the SDK fsl_common.h, just enough for the utilities
+ * which are built and tested on the host.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Construct a status code value from a group and code number. */
+#define MAKE_STATUS(group, code) ((((group)*100L) + (code)))
+
+/*! @brief Status group numbers. */
+enum
+{
+    kStatusGroup_LIST = 142, /*!< Group number for List status codes. */
+};
+
+/*! @brief Type used for all status and error return values. */
+typedef int32_t status_t;
+
+/*! @brief Generic status return codes. */
+enum
+{
+    kStatus_Success         = 0, /*!< Generic status for Success. */
+    kStatus_Fail            = 1, /*!< Generic status for Fail. */
+    kStatus_ReadOnly        = 2, /*!< Generic status for read only failure. */
+    kStatus_OutOfRange      = 3, /*!< Generic status for out of range access. */
+    kStatus_InvalidArgument = 4, /*!< Generic status for invalid argument check. */
+    kStatus_Timeout         = 5, /*!< Generic status for timeout. */
+    kStatus_Busy            = 7, /*!< Generic status for module is busy. */
+    kStatus_NoData          = 8, /*!< Generic status for no data is found for the operation. */
+};
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+/*! @brief Size aligned up to a power of two alignment. */
+#define SDK_SIZEALIGN(var, alignbytes) \
+    ((unsigned int)((var) + ((alignbytes)-1U)) & (unsigned int)(~(unsigned int)((alignbytes)-1U)))
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*! @brief Counts the leading zeros, as the Cortex-M CLZ instruction, 32 for 0. */
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return (0U == value) ? 32U : (uint32_t)__builtin_clz(value);
+}
+
+/*! @brief The host tests are single threaded, masking interrupts is a no-op. */
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    return 0U;
+}
+
+/*! @brief The host tests are single threaded, masking interrupts is a no-op. */
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    (void)primask;
+}
+
+#endif /* _FSL_COMMON_H_ */
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_BOOT_PROFILE_H_
+#define _FSL_BOOT_PROFILE_H_
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup boot_profile
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Enables the boot profile record, filled by the startup code using the DWT cycle counter. */
+#ifndef BOOT_PROFILE_ENABLE
+#define BOOT_PROFILE_ENABLE 1
+#endif /* BOOT_PROFILE_ENABLE */
+
+/*! @brief Number of data sections and of bss sections recorded, the other sections are not recorded. */
+#ifndef BOOT_PROFILE_SECTION_COUNT
+#define BOOT_PROFILE_SECTION_COUNT 4U
+#endif /* BOOT_PROFILE_SECTION_COUNT */
+
+/*! @brief DWT cycle counter, cleared and started by the startup code when the reset handler starts. */
+#define BOOT_PROFILE_CYCCNT (*(volatile uint32_t *)0xE0001004UL)
+
+/*!
+ * @brief Boot phases, in boot order. The timestamp of a phase is taken when the phase is complete.
+ *
+ * The first message can be printed before the power supply is configured, its timestamp is then the
+ * smaller one.
+ */
+typedef enum _boot_profile_phase
+{
+    kBOOT_PROFILE_ResetEntry = 0U,    /*!< Reset handler entered, taken by the startup code. */
+    kBOOT_PROFILE_SystemInit,         /*!< SystemInit done, taken by the startup code. */
+    kBOOT_PROFILE_DataInit,           /*!< Data sections copied, taken by the startup code. */
+    kBOOT_PROFILE_BssInit,            /*!< Bss sections zeroed, taken by the startup code. */
+    kBOOT_PROFILE_Startup,            /*!< Startup code done, the C library and main are called next. */
+    kBOOT_PROFILE_InitPins,           /*!< Pins configured, taken by the application. */
+    kBOOT_PROFILE_InitBootClocks,     /*!< Boot clocks configured, taken by the application. */
+    kBOOT_PROFILE_InitDebugConsole,   /*!< Debug console initialized, taken by the application. */
+    kBOOT_PROFILE_PowerConfiguration, /*!< Power supply configured, taken by the application. */
+    kBOOT_PROFILE_FirstPrintf,        /*!< First message printed, taken by the debug console. */
+    kBOOT_PROFILE_PhaseCount
+} boot_profile_phase_t;
+
+/*! @brief Names of the boot phases, in the order of boot_profile_phase_t. */
+#define BOOT_PROFILE_PHASE_NAME                                                                      \
+    {                                                                                                \
+        "ResetEntry", "SystemInit", "DataInit", "BssInit", "Startup", "InitPins", "InitBootClocks", \
+            "InitDebugConsole", "PowerConfiguration", "FirstPrintf"                                  \
+    }
+
+/*! @brief Initialization record of a data or bss section. */
+typedef struct _boot_profile_section
+{
+    uint32_t address; /*!< Execution address of the section. */
+    uint32_t length;  /*!< Length of the section in bytes. */
+    uint32_t cycles;  /*!< CPU cycles spent to copy or zero the section. */
+} boot_profile_section_t;
+
+/*!
+ * @brief Boot profile record.
+ *
+ * The cycle counter is cleared when the reset handler starts, so the timestamps are CPU cycles
+ * counted from the reset handler entry. The timestamp of a phase not reached yet is 0.
+ */
+typedef struct _boot_profile
+{
+    uint32_t timestamps[kBOOT_PROFILE_PhaseCount]; /*!< Timestamp of each phase, indexed by boot_profile_phase_t. */
+    uint32_t dataSectionCount; /*!< Number of data sections initialized, can exceed BOOT_PROFILE_SECTION_COUNT. */
+    uint32_t bssSectionCount;  /*!< Number of bss sections initialized, can exceed BOOT_PROFILE_SECTION_COUNT. */
+    boot_profile_section_t dataSections[BOOT_PROFILE_SECTION_COUNT]; /*!< Data sections, in initialization order. */
+    boot_profile_section_t bssSections[BOOT_PROFILE_SECTION_COUNT];  /*!< Bss sections, in initialization order. */
+} boot_profile_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+/*! @brief Boot profile record of the current boot, kept in RAM that is not initialized by the startup code. */
+extern boot_profile_t g_bootProfile;
+#endif /* BOOT_PROFILE_ENABLE */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*!
+ * @brief Takes the timestamp of a boot phase.
+ *
+ * Only the first timestamp of a phase is kept, so the function can be called in a loop, for example
+ * after every message to time the first one.
+ *
+ * @param phase Boot phase just completed.
+ */
+static inline void BootProfile_Mark(boot_profile_phase_t phase)
+{
+#if (defined(BOOT_PROFILE_ENABLE) && (BOOT_PROFILE_ENABLE > 0U))
+    if (0U == g_bootProfile.timestamps[phase])
+    {
+        g_bootProfile.timestamps[phase] = BOOT_PROFILE_CYCCNT;
+    }
+#else
+    (void)phase;
+#endif /* BOOT_PROFILE_ENABLE */
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_BOOT_PROFILE_H_ */
@@ -16,6 +16,11 @@
 #include "fsl_debug_console.h"
 #include "fsl_adapter_uart.h"
 #include "fsl_str.h"
+#include "fsl_boot_profile.h"
+#if ((defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U)) || \
+     (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U)))
+#include "fsl_lpuart.h"
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE || DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
 
 /*! @brief Keil: suppress ellipsis warning in va_arg usage below. */
 #if defined(__CC_ARM)
@@ -34,6 +39,14 @@
 #define HUGE_VAL (99.e99)
 #endif /* HUGE_VAL */
 
+/*! @brief The debug console owns an LPUART transactional handle, for the RX or the TX ring buffer. */
+#if ((defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U)) || \
+     (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U)))
+#define DEBUG_CONSOLE_LPUART_HANDLE_ENABLE 1U
+#else
+#define DEBUG_CONSOLE_LPUART_HANDLE_ENABLE 0U
+#endif
+
 /*! @brief State structure storing debug console. */
 typedef struct DebugConsoleState
 {
@@ -45,10 +58,46 @@ typedef struct DebugConsoleState
                                  uint8_t *data,
                                  size_t length); /*!< get char function pointer */
     serial_port_type_t serial_port_type;         /*!< The initialized port of the debug console. */
+#if (DEBUG_CONSOLE_LPUART_HANDLE_ENABLE > 0U)
+    LPUART_Type *lpuartBase;      /*!< LPUART used by the debug console. */
+    lpuart_handle_t lpuartHandle; /*!< LPUART handle owning the ring buffers. */
+#endif /* DEBUG_CONSOLE_LPUART_HANDLE_ENABLE */
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    uint8_t txRingBuffer[DEBUG_CONSOLE_TX_RING_BUFFER_SIZE]; /*!< TX ring buffer. */
+    volatile size_t txHead;                                  /*!< Index the next output is written to. */
+    volatile size_t txTail;                                  /*!< Index of the first byte not sent yet. */
+    volatile size_t txSending;                               /*!< Bytes from txTail in the running LPUART transfer. */
+    volatile bool txPrinting;                                /*!< A print is formatting into the ring buffer. */
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+    uint8_t rxRingBuffer[DEBUG_CONSOLE_RX_RING_BUFFER_SIZE]; /*!< RX ring buffer. */
+    union
+    {
+        char rxLine[DEBUG_CONSOLE_RX_LINE_SIZE + 1U];        /*!< Command line being assembled. */
+        uint8_t rxPacket[DEBUG_CONSOLE_RX_RING_BUFFER_SIZE]; /*!< Packet wrapping around the ring buffer end. */
+    };
+    size_t rxLineLength;                                     /*!< Length of the command line being assembled. */
+    dbg_console_line_callback_t volatile lineCallback;       /*!< Line input callback, NULL if inactive. */
+    void *lineUserData;                                      /*!< Parameter of the line input callback. */
+    dbg_console_packet_callback_t volatile packetCallback;   /*!< Packet input callback, NULL if inactive. */
+    void *packetUserData;                                    /*!< Parameter of the packet input callback. */
+    bool rxPacketDropped;                                    /*!< Rest of a too long packet is being dropped. */
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
 } debug_console_state_t;
 
-/*! @brief Type of KSDK printf function pointer. */
-typedef int (*PUTCHAR_FUNC)(int a);
+/*! @brief Output of one formatted print, passed to DbgConsole_PrintCallback as its buffer. */
+typedef struct _debug_console_print
+{
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    size_t head;   /*!< Ring buffer index of the next character, published to txHead when queued. */
+    size_t space;  /*!< Free bytes of the ring buffer from head. */
+    size_t queued; /*!< Characters written to the ring buffer. */
+    bool wait;     /*!< Wait for space when the ring buffer is full, otherwise drop the rest. */
+#else
+    uint8_t data[DEBUG_CONSOLE_PRINTF_BUFFER_SIZE]; /*!< Characters not sent yet. */
+    size_t length;                                  /*!< Number of characters in data. */
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+} debug_console_print_t;
 
 /*******************************************************************************
  * Variables
@@ -56,14 +105,46 @@ typedef int (*PUTCHAR_FUNC)(int a);
 #if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) || defined(SDK_DEBUGCONSOLE_UART))
 /*! @brief Debug UART state information. */
 static debug_console_state_t s_debugConsole;
+#if (DEBUG_CONSOLE_LPUART_HANDLE_ENABLE > 0U)
+/*! @brief LPUART base addresses, indexed by the debug console instance. */
+static LPUART_Type *const s_dbgConsoleLpuartBases[] = LPUART_BASE_PTRS;
+/*! @brief LPUART IRQ numbers, indexed by the debug console instance. */
+static const IRQn_Type s_dbgConsoleLpuartIrqs[] = LPUART_RX_TX_IRQS;
+#endif /* DEBUG_CONSOLE_LPUART_HANDLE_ENABLE */
 #endif
 
+#if (DEBUG_CONSOLE_LOG_LEVEL > DEBUG_CONSOLE_LOG_LEVEL_NONE)
+/* All built in log levels and all module tags are enabled by default. */
+volatile uint32_t g_dbgConsoleLogLevelMask  = 0xFFFFFFFFU;
+volatile uint32_t g_dbgConsoleLogModuleMask = 0xFFFFFFFFU;
+#endif /* DEBUG_CONSOLE_LOG_LEVEL */
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 #if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
-static int DbgConsole_PrintfFormattedData(PUTCHAR_FUNC func_ptr, const char *fmt, va_list ap);
+static void DbgConsole_PrintCallback(char *buf, int32_t *indicator, char dbgVal, int len);
+#endif /* SDK_DEBUGCONSOLE */
+#if ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) || defined(SDK_DEBUGCONSOLE_UART))
+#if (DEBUG_CONSOLE_LPUART_HANDLE_ENABLE > 0U)
+static void DbgConsole_LpuartCallback(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData);
+#endif /* DEBUG_CONSOLE_LPUART_HANDLE_ENABLE */
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+static hal_uart_status_t DbgConsole_WriteTxRingBuffer(hal_uart_handle_t handle, const uint8_t *data, size_t length);
+static void DbgConsole_WaitTxRingBuffer(uint32_t irqMask, bool untilEmpty);
+static void DbgConsole_StartTxRingBuffer(void);
+static void DbgConsole_DrainTxRingBuffer(void);
+#if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
+static bool DbgConsole_BeginTxRingPrint(debug_console_print_t *print, bool wait);
+static void DbgConsole_EndTxRingPrint(debug_console_print_t *print);
 #endif /* SDK_DEBUGCONSOLE */
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+static hal_uart_status_t DbgConsole_ReadRingBuffer(hal_uart_handle_t handle, uint8_t *data, size_t length);
+static void DbgConsole_DeliverLine(void);
+static void DbgConsole_DeliverPacket(LPUART_Type *base, lpuart_handle_t *handle, status_t status);
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
+#endif
 
 /*******************************************************************************
  * Code
@@ -102,7 +183,30 @@ status_t DbgConsole_Init(uint8_t instance, uint32_t baudRate, serial_port_type_t
     (void)HAL_UartInit((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], &usrtConfig);
     /* Set the function pointer for send and receive for this kind of device. */
     s_debugConsole.putChar = HAL_UartSendBlocking;
+#if (DEBUG_CONSOLE_LPUART_HANDLE_ENABLE > 0U)
+    s_debugConsole.lpuartBase = s_dbgConsoleLpuartBases[instance];
+    LPUART_TransferCreateHandle(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle, DbgConsole_LpuartCallback,
+                                NULL);
+#endif /* DEBUG_CONSOLE_LPUART_HANDLE_ENABLE */
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    /* Queue the output, the LPUART interrupt sends it in the background. */
+    s_debugConsole.txHead    = 0U;
+    s_debugConsole.txTail    = 0U;
+    s_debugConsole.txSending  = 0U;
+    s_debugConsole.txPrinting = false;
+    s_debugConsole.putChar    = DbgConsole_WriteTxRingBuffer;
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+    /* Receive in the background, the end of each receive burst is reported by the idle line interrupt. */
+    s_debugConsole.lineCallback   = NULL;
+    s_debugConsole.packetCallback = NULL;
+    LPUART_TransferStartRingBuffer(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle,
+                                   &s_debugConsole.rxRingBuffer[0], sizeof(s_debugConsole.rxRingBuffer));
+    LPUART_EnableInterrupts(s_debugConsole.lpuartBase, (uint32_t)kLPUART_IdleLineInterruptEnable);
+    s_debugConsole.getChar = DbgConsole_ReadRingBuffer;
+#else
     s_debugConsole.getChar = HAL_UartReceiveBlocking;
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
 
     return kStatus_Success;
 }
@@ -115,6 +219,18 @@ status_t DbgConsole_Deinit(void)
         return kStatus_Success;
     }
 
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    (void)DbgConsole_Flush();
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+#if (DEBUG_CONSOLE_LPUART_HANDLE_ENABLE > 0U)
+    (void)DisableIRQ(s_dbgConsoleLpuartIrqs[LPUART_GetInstance(s_debugConsole.lpuartBase)]);
+#endif /* DEBUG_CONSOLE_LPUART_HANDLE_ENABLE */
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+    LPUART_DisableInterrupts(s_debugConsole.lpuartBase, (uint32_t)kLPUART_IdleLineInterruptEnable);
+    LPUART_TransferStopRingBuffer(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle);
+    s_debugConsole.lineCallback   = NULL;
+    s_debugConsole.packetCallback = NULL;
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
     (void)HAL_UartDeinit((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0]);
 
     s_debugConsole.serial_port_type = kSerialPort_None;
@@ -127,6 +243,9 @@ status_t DbgConsole_EnterLowpower(void)
     hal_uart_status_t DbgConsoleUartStatus = kStatus_HAL_UartError;
     if (kSerialPort_Uart == s_debugConsole.serial_port_type)
     {
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+        (void)DbgConsole_Flush();
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
         DbgConsoleUartStatus = HAL_UartEnterLowpower((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0]);
     }
     return (status_t)DbgConsoleUartStatus;
@@ -143,6 +262,388 @@ status_t DbgConsole_ExitLowpower(void)
     return (status_t)DbgConsoleUartStatus;
 }
 
+/* See fsl_debug_console.h for documentation of this function. */
+status_t DbgConsole_Flush(void)
+{
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    uint32_t irqMask;
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
+    if (kSerialPort_None == s_debugConsole.serial_port_type)
+    {
+        return kStatus_Fail;
+    }
+
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    irqMask = DisableGlobalIRQ();
+    DbgConsole_WaitTxRingBuffer(irqMask, true);
+    EnableGlobalIRQ(irqMask);
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
+    return kStatus_Success;
+}
+
+#if (DEBUG_CONSOLE_LPUART_HANDLE_ENABLE > 0U)
+/*!
+ * @brief Continues the TX ring buffer transfer, and assembles the data in the RX ring buffer into command
+ * lines or packets.
+ *
+ * Called in the LPUART interrupt when a TX transfer is complete, at the end of each receive burst, or when
+ * the RX ring buffer is full.
+ *
+ * @param[in] base    LPUART peripheral base address.
+ * @param[in] handle  LPUART handle owning the ring buffers.
+ * @param[in] status  LPUART transfer status.
+ * @param[in] userData Unused.
+ */
+static void DbgConsole_LpuartCallback(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData)
+{
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+    lpuart_transfer_t xfer;
+    uint8_t ch;
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
+
+    (void)userData;
+
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    if (kStatus_LPUART_TxIdle == status)
+    {
+        s_debugConsole.txTail =
+            (s_debugConsole.txTail + s_debugConsole.txSending) % DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+        s_debugConsole.txSending = 0U;
+        DbgConsole_StartTxRingBuffer();
+        return;
+    }
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+    if ((kStatus_LPUART_IdleLineDetected != status) && (kStatus_LPUART_RxRingBufferOverrun != status))
+    {
+        return;
+    }
+
+    if (NULL != s_debugConsole.packetCallback)
+    {
+        DbgConsole_DeliverPacket(base, handle, status);
+        return;
+    }
+
+    xfer.rxData   = &ch;
+    xfer.dataSize = 1U;
+
+    /* Stop consuming as soon as the line input is stopped, so the rest can be read by DbgConsole_Getchar. */
+    while ((NULL != s_debugConsole.lineCallback) && (0U != LPUART_TransferGetRxRingBufferLength(base, handle)))
+    {
+        (void)LPUART_TransferReceiveNonBlocking(base, handle, &xfer, NULL);
+
+        if (((uint8_t)'\r' == ch) || ((uint8_t)'\n' == ch))
+        {
+            /* Empty lines are ignored, this also drops the second char of "\r\n". */
+            if (0U != s_debugConsole.rxLineLength)
+            {
+                DbgConsole_DeliverLine();
+            }
+        }
+        else
+        {
+            s_debugConsole.rxLine[s_debugConsole.rxLineLength] = (char)ch;
+            s_debugConsole.rxLineLength++;
+            if (DEBUG_CONSOLE_RX_LINE_SIZE == s_debugConsole.rxLineLength)
+            {
+                DbgConsole_DeliverLine();
+            }
+        }
+    }
+#else
+    (void)base;
+    (void)handle;
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
+}
+#endif /* DEBUG_CONSOLE_LPUART_HANDLE_ENABLE */
+
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+/*************Code for TX ring buffer*******************************/
+/*!
+ * @brief Queues data in the TX ring buffer, the core sleeps while the ring buffer is full.
+ *
+ * @param[in] handle  Unused, the debug console LPUART handle is used.
+ * @param[in] data    Data to send.
+ * @param[in] length  Number of bytes to send.
+ * @return kStatus_HAL_UartError if called from an interrupt preempting a print, the data is dropped,
+ *         otherwise kStatus_HAL_UartSuccess.
+ */
+static hal_uart_status_t DbgConsole_WriteTxRingBuffer(hal_uart_handle_t handle, const uint8_t *data, size_t length)
+{
+    size_t head;
+    size_t count;
+    uint32_t irqMask;
+
+    (void)handle;
+
+    while (0U != length)
+    {
+        irqMask = DisableGlobalIRQ();
+        if (s_debugConsole.txPrinting)
+        {
+            /* The preempted print owns the ring buffer from txHead on. */
+            EnableGlobalIRQ(irqMask);
+            return kStatus_HAL_UartError;
+        }
+        DbgConsole_WaitTxRingBuffer(irqMask, false);
+
+        /* Copy up to the free space or the end of the buffer, the rest goes in the next round. */
+        head  = s_debugConsole.txHead;
+        count = (s_debugConsole.txTail + DEBUG_CONSOLE_TX_RING_BUFFER_SIZE - head - 1U) %
+                DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+        count = MIN(MIN(count, length), DEBUG_CONSOLE_TX_RING_BUFFER_SIZE - head);
+        (void)memcpy(&s_debugConsole.txRingBuffer[head], data, count);
+        s_debugConsole.txHead = (head + count) % DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+        DbgConsole_StartTxRingBuffer();
+        EnableGlobalIRQ(irqMask);
+
+        data = &data[count];
+        length -= count;
+    }
+
+    return kStatus_HAL_UartSuccess;
+}
+
+/*!
+ * @brief Waits until the TX ring buffer has space, or until all of it is sent out.
+ *
+ * Called with interrupts masked, the core sleeps until the LPUART interrupt sends the data. A caller which
+ * already had interrupts masked, or runs in an interrupt, cannot be preempted by the LPUART interrupt, so
+ * the data is sent by polling instead.
+ *
+ * @param[in] irqMask     Interrupt mask returned by DisableGlobalIRQ.
+ * @param[in] untilEmpty  Wait until the ring buffer is empty and the last character is sent out.
+ */
+static void DbgConsole_WaitTxRingBuffer(uint32_t irqMask, bool untilEmpty)
+{
+    size_t next;
+
+    for (;;)
+    {
+        next = (s_debugConsole.txHead + 1U) % DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+        if (untilEmpty ? ((s_debugConsole.txHead == s_debugConsole.txTail) && (0U == s_debugConsole.txSending)) :
+                         (next != s_debugConsole.txTail))
+        {
+            break;
+        }
+
+        if ((0U != irqMask) || (0U != __get_IPSR()))
+        {
+            DbgConsole_DrainTxRingBuffer();
+        }
+        else
+        {
+            /* A transfer completing between the check and WFI still wakes the core up. */
+            __WFI();
+            EnableGlobalIRQ(irqMask);
+            (void)DisableGlobalIRQ();
+        }
+    }
+}
+
+/*!
+ * @brief Starts sending the TX ring buffer if no transfer is running.
+ *
+ * Called with interrupts masked or in the LPUART interrupt. The transfer ends at the end of the buffer,
+ * the wrapped part is sent when it completes.
+ */
+static void DbgConsole_StartTxRingBuffer(void)
+{
+    lpuart_transfer_t xfer;
+    size_t head = s_debugConsole.txHead;
+    size_t tail = s_debugConsole.txTail;
+
+    if ((0U != s_debugConsole.txSending) || (head == tail))
+    {
+        return;
+    }
+
+    xfer.txData              = &s_debugConsole.txRingBuffer[tail];
+    xfer.dataSize            = (head > tail) ? (head - tail) : (DEBUG_CONSOLE_TX_RING_BUFFER_SIZE - tail);
+    s_debugConsole.txSending = xfer.dataSize;
+    (void)LPUART_TransferSendNonBlocking(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle, &xfer);
+}
+
+/*!
+ * @brief Sends the rest of the TX ring buffer by polling, with interrupts masked.
+ *
+ * The running transfer is aborted, the bytes it already wrote to the TX FIFO still go out and are not sent
+ * again. LPUART_WriteBlocking returns when the last character is sent out.
+ */
+static void DbgConsole_DrainTxRingBuffer(void)
+{
+    size_t head = s_debugConsole.txHead;
+    size_t tail = s_debugConsole.txTail;
+    size_t count;
+
+    if (0U != s_debugConsole.txSending)
+    {
+        tail = (tail + s_debugConsole.txSending - s_debugConsole.lpuartHandle.txDataSize) %
+               DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+        LPUART_TransferAbortSend(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle);
+        s_debugConsole.txSending = 0U;
+    }
+
+    while (head != tail)
+    {
+        count = (head > tail) ? (head - tail) : (DEBUG_CONSOLE_TX_RING_BUFFER_SIZE - tail);
+        (void)LPUART_WriteBlocking(s_debugConsole.lpuartBase, &s_debugConsole.txRingBuffer[tail], count);
+        tail = (tail + count) % DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+    }
+    s_debugConsole.txTail = tail;
+}
+
+#if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
+/*!
+ * @brief Starts a print formatting straight into the free space of the TX ring buffer.
+ *
+ * No critical section is needed: a print from an interrupt which preempts this function before the flag
+ * is set completes before txHead is read here, and one which preempts it afterwards sees the flag.
+ *
+ * @param[out] print  Output state of the print.
+ * @param[in] wait    Wait for space when the ring buffer is full, otherwise drop the rest.
+ * @return false if the print preempts another print, which owns the ring buffer from txHead on.
+ */
+static bool DbgConsole_BeginTxRingPrint(debug_console_print_t *print, bool wait)
+{
+    if (s_debugConsole.txPrinting)
+    {
+        return false;
+    }
+    s_debugConsole.txPrinting = true;
+
+    print->head   = s_debugConsole.txHead;
+    print->space  = (s_debugConsole.txTail + DEBUG_CONSOLE_TX_RING_BUFFER_SIZE - print->head - 1U) %
+                   DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+    print->queued = 0U;
+    print->wait   = wait;
+    return true;
+}
+
+/*!
+ * @brief Queues the characters formatted into the TX ring buffer and starts sending them.
+ *
+ * @param[in] print  Output state of the print.
+ */
+static void DbgConsole_EndTxRingPrint(debug_console_print_t *print)
+{
+    uint32_t irqMask;
+
+    irqMask               = DisableGlobalIRQ();
+    s_debugConsole.txHead = print->head;
+    DbgConsole_StartTxRingBuffer();
+    s_debugConsole.txPrinting = false;
+    EnableGlobalIRQ(irqMask);
+}
+#endif /* SDK_DEBUGCONSOLE */
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+/*************Code for RX ring buffer*******************************/
+/*!
+ * @brief Reads data from the RX ring buffer, the core sleeps until enough data is received.
+ *
+ * @param[in] handle  Unused, the debug console LPUART handle is used.
+ * @param[out] data   Buffer to store the received data.
+ * @param[in] length  Number of bytes to read.
+ * @return kStatus_HAL_UartSuccess, or kStatus_HAL_UartError if line or packet input is active.
+ */
+static hal_uart_status_t DbgConsole_ReadRingBuffer(hal_uart_handle_t handle, uint8_t *data, size_t length)
+{
+    lpuart_transfer_t xfer;
+    uint32_t irqMask;
+
+    (void)handle;
+    assert(length < sizeof(s_debugConsole.rxRingBuffer));
+
+    if ((NULL != s_debugConsole.lineCallback) || (NULL != s_debugConsole.packetCallback))
+    {
+        return kStatus_HAL_UartError;
+    }
+
+    /* Interrupts are masked between the check and WFI, a byte received in between still wakes the core up. */
+    irqMask = DisableGlobalIRQ();
+    while (LPUART_TransferGetRxRingBufferLength(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle) < length)
+    {
+        __WFI();
+        EnableGlobalIRQ(irqMask);
+        irqMask = DisableGlobalIRQ();
+    }
+    EnableGlobalIRQ(irqMask);
+
+    xfer.rxData   = data;
+    xfer.dataSize = length;
+    if (kStatus_Success !=
+        LPUART_TransferReceiveNonBlocking(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle, &xfer, NULL))
+    {
+        return kStatus_HAL_UartError;
+    }
+
+    return kStatus_HAL_UartSuccess;
+}
+
+/*!
+ * @brief Terminates the assembled command line and passes it to the line input callback.
+ */
+static void DbgConsole_DeliverLine(void)
+{
+    dbg_console_line_callback_t callback = s_debugConsole.lineCallback;
+
+    s_debugConsole.rxLine[s_debugConsole.rxLineLength] = '\0';
+    callback(&s_debugConsole.rxLine[0], s_debugConsole.rxLineLength, s_debugConsole.lineUserData);
+    s_debugConsole.rxLineLength = 0U;
+}
+
+/*!
+ * @brief Passes the data received in one burst to the packet input callback.
+ *
+ * The packet is passed in place when it is contiguous in the RX ring buffer, a packet that does
+ * not fit in the ring buffer is dropped up to the next idle line.
+ *
+ * @param[in] base    LPUART peripheral base address.
+ * @param[in] handle  LPUART handle owning the RX ring buffer.
+ * @param[in] status  kStatus_LPUART_IdleLineDetected or kStatus_LPUART_RxRingBufferOverrun.
+ */
+static void DbgConsole_DeliverPacket(LPUART_Type *base, lpuart_handle_t *handle, status_t status)
+{
+    lpuart_rx_ring_buffer_span_t spans[2];
+    const uint8_t *packet;
+    size_t length;
+
+    length = LPUART_TransferPeekRxRingBuffer(base, handle, spans);
+    packet = spans[0].data;
+
+    if (kStatus_LPUART_RxRingBufferOverrun == status)
+    {
+        s_debugConsole.rxPacketDropped = true;
+    }
+    else if (s_debugConsole.rxPacketDropped)
+    {
+        s_debugConsole.rxPacketDropped = false;
+    }
+    else if (0U != length)
+    {
+        if (0U != spans[1].size)
+        {
+            (void)memcpy(&s_debugConsole.rxPacket[0], spans[0].data, spans[0].size);
+            (void)memcpy(&s_debugConsole.rxPacket[spans[0].size], spans[1].data, spans[1].size);
+            packet = &s_debugConsole.rxPacket[0];
+        }
+        s_debugConsole.packetCallback(packet, length, s_debugConsole.packetUserData);
+    }
+    else
+    {
+        /* Avoid MISRA 15.7 */
+    }
+
+    LPUART_TransferConsumeRxRingBuffer(base, handle, length);
+}
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
+
 #endif /* DEBUGCONSOLE_REDIRECT_TO_SDK */
 
 #if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
@@ -162,6 +663,7 @@ int DbgConsole_Printf(const char *fmt_s, ...)
 /* See fsl_debug_console.h for documentation of this function. */
 int DbgConsole_Vprintf(const char *fmt_s, va_list formatStringArg)
 {
+    debug_console_print_t print;
     int result = 0;
 
     /* Do nothing if the debug UART is not initialized. */
@@ -170,11 +672,70 @@ int DbgConsole_Vprintf(const char *fmt_s, va_list formatStringArg)
         return -1;
     }
 
-    result = DbgConsole_PrintfFormattedData(DbgConsole_Putchar, fmt_s, formatStringArg);
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    if (!DbgConsole_BeginTxRingPrint(&print, true))
+    {
+        return -1;
+    }
+    result = StrFormatPrintf(fmt_s, formatStringArg, (char *)(void *)&print, DbgConsole_PrintCallback);
+    DbgConsole_EndTxRingPrint(&print);
+#else
+    print.length = 0U;
+    result       = StrFormatPrintf(fmt_s, formatStringArg, (char *)(void *)&print, DbgConsole_PrintCallback);
+    if (0U != print.length)
+    {
+        (void)s_debugConsole.putChar((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], print.data,
+                                     print.length);
+    }
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
+    /* Only the first message of the boot is timed, whichever module prints it. */
+    BootProfile_Mark(kBOOT_PROFILE_FirstPrintf);
 
     return result;
 }
 
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+/* See fsl_debug_console.h for documentation of this function. */
+int DbgConsole_TryVprintf(size_t *queued, const char *fmt_s, va_list formatStringArg)
+{
+    debug_console_print_t print;
+    int result;
+
+    if (NULL != queued)
+    {
+        *queued = 0U;
+    }
+
+    /* Do nothing if the debug UART is not initialized. */
+    if ((kSerialPort_None == s_debugConsole.serial_port_type) || !DbgConsole_BeginTxRingPrint(&print, false))
+    {
+        return -1;
+    }
+    result = StrFormatPrintf(fmt_s, formatStringArg, (char *)(void *)&print, DbgConsole_PrintCallback);
+    DbgConsole_EndTxRingPrint(&print);
+
+    if (NULL != queued)
+    {
+        *queued = print.queued;
+    }
+    return result;
+}
+
+/* See fsl_debug_console.h for documentation of this function. */
+int DbgConsole_TryPrintf(size_t *queued, const char *fmt_s, ...)
+{
+    va_list ap;
+    int result;
+
+    va_start(ap, fmt_s);
+    result = DbgConsole_TryVprintf(queued, fmt_s, ap);
+    va_end(ap);
+
+    return result;
+}
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
 /* See fsl_debug_console.h for documentation of this function. */
 int DbgConsole_Putchar(int dbgConsoleCh)
 {
@@ -188,6 +749,27 @@ int DbgConsole_Putchar(int dbgConsoleCh)
     return 1;
 }
 
+/* See fsl_debug_console.h for documentation of this function. */
+int DbgConsole_SendData(const uint8_t *data, size_t length)
+{
+    /* Do nothing if the debug UART is not initialized. */
+    if (kSerialPort_None == s_debugConsole.serial_port_type)
+    {
+        return -1;
+    }
+    if (0U == length)
+    {
+        return 0;
+    }
+    if (kStatus_HAL_UartSuccess !=
+        s_debugConsole.putChar((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], data, length))
+    {
+        return -1;
+    }
+
+    return (int)length;
+}
+
 /* See fsl_debug_console.h for documentation of this function. */
 int DbgConsole_Scanf(char *fmt_s, ...)
 {
@@ -265,898 +847,155 @@ int DbgConsole_Getchar(void)
     return (int)dbgConsoleCh;
 }
 
-/*************Code for process formatted data*******************************/
-/*!
- * @brief This function puts padding character.
- *
- * @param[in] c         Padding character.
- * @param[in] curlen    Length of current formatted string .
- * @param[in] width     Width of expected formatted string.
- * @param[in] count     Number of characters.
- * @param[in] func_ptr  Function to put character out.
- */
-static void DbgConsole_PrintfPaddingCharacter(
-    char c, int32_t curlen, int32_t width, int32_t *count, PUTCHAR_FUNC func_ptr)
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+/* See fsl_debug_console.h for documentation of this function. */
+status_t DbgConsole_StartLineInput(dbg_console_line_callback_t callback, void *userData)
 {
-    int32_t i;
+    uint32_t irqMask;
+
+    assert(NULL != callback);
 
-    for (i = curlen; i < width; i++)
+    if ((kSerialPort_None == s_debugConsole.serial_port_type) || (NULL != s_debugConsole.packetCallback))
     {
-        (void)func_ptr(c);
-        (*count)++;
+        return kStatus_Fail;
     }
-}
 
-/*!
- * @brief Converts a radix number to a string and return its length.
- *
- * @param[in] numstr    Converted string of the number.
- * @param[in] nump      Pointer to the number.
- * @param[in] neg       Polarity of the number.
- * @param[in] radix     The radix to be converted to.
- * @param[in] use_caps  Used to identify %x/X output format.
+    /* Data already in the ring buffer is assembled together with the next receive burst. */
+    irqMask                     = DisableGlobalIRQ();
+    s_debugConsole.rxLineLength = 0U;
+    s_debugConsole.lineUserData = userData;
+    s_debugConsole.lineCallback = callback;
+    EnableGlobalIRQ(irqMask);
 
- * @return Length of the converted string.
- */
-static int32_t DbgConsole_ConvertRadixNumToString(char *numstr, void *nump, int32_t neg, int32_t radix, bool use_caps)
+    return kStatus_Success;
+}
+
+/* See fsl_debug_console.h for documentation of this function. */
+void DbgConsole_StopLineInput(void)
 {
-#if PRINTF_ADVANCED_ENABLE
-    long long int a;
-    long long int b;
-    long long int c;
-
-    unsigned long long int ua;
-    unsigned long long int ub;
-    unsigned long long int uc;
-    unsigned long long int uc_param;
-#else
-    int a;
-    int b;
-    int c;
+    uint32_t irqMask;
 
-    unsigned int ua;
-    unsigned int ub;
-    unsigned int uc;
-    unsigned int uc_param;
-#endif /* PRINTF_ADVANCED_ENABLE */
+    irqMask                     = DisableGlobalIRQ();
+    s_debugConsole.lineCallback = NULL;
+    s_debugConsole.rxLineLength = 0U;
+    EnableGlobalIRQ(irqMask);
+}
 
-    int32_t nlen;
-    char *nstrp;
+/* See fsl_debug_console.h for documentation of this function. */
+status_t DbgConsole_StartPacketInput(dbg_console_packet_callback_t callback, void *userData)
+{
+    uint32_t irqMask;
 
-    nlen     = 0;
-    nstrp    = numstr;
-    *nstrp++ = '\0';
+    assert(NULL != callback);
 
-#if !(PRINTF_ADVANCED_ENABLE > 0)
-    neg = 0;
-#endif
-
-#if PRINTF_ADVANCED_ENABLE
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0ULL;
-    ub       = 0ULL;
-    uc       = 0ULL;
-    uc_param = 0ULL;
-#else
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0U;
-    ub       = 0U;
-    uc       = 0U;
-    uc_param = 0U;
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-    (void)a;
-    (void)b;
-    (void)c;
-    (void)ua;
-    (void)ub;
-    (void)uc;
-    (void)uc_param;
-    (void)neg;
-    /*
-     * Fix MISRA issue: CID 15985711 (#15 of 15): MISRA C-2012 Control Flow Expressions (MISRA C-2012 Rule 14.3)
-     * misra_c_2012_rule_14_3_violation: Execution cannot reach this statement: a = *((int *)nump);
-     */
-#if PRINTF_ADVANCED_ENABLE
-    if (0 != neg)
+    if ((kSerialPort_None == s_debugConsole.serial_port_type) || (NULL != s_debugConsole.lineCallback))
     {
-#if PRINTF_ADVANCED_ENABLE
-        a = *(long long int *)nump;
-#else
-        a = *(int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (a == 0)
-        {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
-        }
-        while (a != 0)
-        {
-#if PRINTF_ADVANCED_ENABLE
-            b = (long long int)a / (long long int)radix;
-            c = (long long int)a - ((long long int)b * (long long int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned long long int)c;
-                uc_param = ~uc;
-                c        = (long long int)uc_param + 1 + (long long int)'0';
-            }
-#else
-            b = (int)a / (int)radix;
-            c = (int)a - ((int)b * (int)radix);
-            if (c < 0)
-            {
-                uc       = (unsigned int)c;
-                uc_param = ~uc;
-                c        = (int)uc_param + 1 + (int)'0';
-            }
-#endif /* PRINTF_ADVANCED_ENABLE */
-            else
-            {
-                c = c + (int)'0';
-            }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
-        }
+        return kStatus_Fail;
     }
-    else
-#endif /* PRINTF_ADVANCED_ENABLE */
-    {
-#if PRINTF_ADVANCED_ENABLE
-        ua = *(unsigned long long int *)nump;
-#else
-        ua = *(unsigned int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (ua == 0U)
-        {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
-        }
-        while (ua != 0U)
-        {
-#if PRINTF_ADVANCED_ENABLE
-            ub = (unsigned long long int)ua / (unsigned long long int)radix;
-            uc = (unsigned long long int)ua - ((unsigned long long int)ub * (unsigned long long int)radix);
-#else
-            ub = ua / (unsigned int)radix;
-            uc = ua - (ub * (unsigned int)radix);
-#endif /* PRINTF_ADVANCED_ENABLE */
 
-            if (uc < 10U)
-            {
-                uc = uc + (unsigned int)'0';
-            }
-            else
-            {
-                uc = uc - 10U + (unsigned int)(use_caps ? 'A' : 'a');
-            }
-            ua       = ub;
-            *nstrp++ = (char)uc;
-            ++nlen;
-        }
-    }
-    return nlen;
-}
+    /* Data already in the ring buffer belongs to no packet. */
+    irqMask = DisableGlobalIRQ();
+    LPUART_TransferConsumeRxRingBuffer(
+        s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle,
+        LPUART_TransferGetRxRingBufferLength(s_debugConsole.lpuartBase, &s_debugConsole.lpuartHandle));
+    s_debugConsole.rxPacketDropped = false;
+    s_debugConsole.packetUserData  = userData;
+    s_debugConsole.packetCallback  = callback;
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+    /* Interrupt once per half FIFO instead of every byte, the idle line interrupt takes the rest. */
+    LPUART_SetRxFifoWatermark(s_debugConsole.lpuartBase,
+                              (uint8_t)(FSL_FEATURE_LPUART_FIFO_SIZEn(s_debugConsole.lpuartBase) / 2U));
+#endif
+    EnableGlobalIRQ(irqMask);
 
-#if PRINTF_FLOAT_ENABLE
-/*!
- * @brief Converts a floating radix number to a string and return its length.
- *
- * @param[in] numstr            Converted string of the number.
- * @param[in] nump              Pointer to the number.
- * @param[in] radix             The radix to be converted to.
- * @param[in] precision_width   Specify the precision width.
+    return kStatus_Success;
+}
 
- * @return Length of the converted string.
- */
-static int32_t DbgConsole_ConvertFloatRadixNumToString(char *numstr,
-                                                       void *nump,
-                                                       int32_t radix,
-                                                       uint32_t precision_width)
+/* See fsl_debug_console.h for documentation of this function. */
+void DbgConsole_StopPacketInput(void)
 {
-    int32_t a;
-    int32_t b;
-    int32_t c;
-    uint32_t i;
-    double fa;
-    double dc;
-    double fb;
-    double r;
-    double fractpart;
-    double intpart;
-
-    int32_t nlen;
-    char *nstrp;
-    nlen     = 0;
-    nstrp    = numstr;
-    *nstrp++ = '\0';
-    r        = *(double *)nump;
-    if (0.0 == r)
-    {
-        *nstrp = '0';
-        ++nlen;
-        return nlen;
-    }
-    fractpart = modf((double)r, (double *)&intpart);
-    /* Process fractional part. */
-    for (i = 0; i < precision_width; i++)
-    {
-        fractpart *= (double)radix;
-    }
-    if (r >= 0.0)
-    {
-        fa = fractpart + (double)0.5;
-        if (fa >= pow((double)10, (double)precision_width))
-        {
-            intpart++;
-        }
-    }
-    else
-    {
-        fa = fractpart - (double)0.5;
-        if (fa <= -pow((double)10, (double)precision_width))
-        {
-            intpart--;
-        }
-    }
-    for (i = 0; i < precision_width; i++)
-    {
-        fb = fa / (double)radix;
-        dc = (fa - (double)(long long int)fb * (double)radix);
-        c  = (int32_t)dc;
-        if (c < 0)
-        {
-            c = (int32_t)'0' - c;
-        }
-        else
-        {
-            c = c + '0';
-        }
-        fa       = fb;
-        *nstrp++ = (char)c;
-        ++nlen;
-    }
-    *nstrp++ = (char)'.';
-    ++nlen;
-    a = (int32_t)intpart;
-    if (a == 0)
-    {
-        *nstrp++ = '0';
-        ++nlen;
-    }
-    else
+    uint32_t irqMask;
+
+    if (kSerialPort_None == s_debugConsole.serial_port_type)
     {
-        while (a != 0)
-        {
-            b = (int32_t)a / (int32_t)radix;
-            c = (int32_t)a - ((int32_t)b * (int32_t)radix);
-            if (c < 0)
-            {
-                c = (int32_t)'0' - c;
-            }
-            else
-            {
-                c = c + '0';
-            }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
-        }
+        return;
     }
-    return nlen;
+
+    irqMask                       = DisableGlobalIRQ();
+    s_debugConsole.packetCallback = NULL;
+#if defined(FSL_FEATURE_LPUART_HAS_FIFO) && FSL_FEATURE_LPUART_HAS_FIFO
+    LPUART_SetRxFifoWatermark(s_debugConsole.lpuartBase, 0U);
+#endif
+    EnableGlobalIRQ(irqMask);
 }
-#endif /* PRINTF_FLOAT_ENABLE */
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
 
+/*************Code for process formatted data*******************************/
 /*!
- * @brief This function outputs its parameters according to a formatted string.
- *
- * @note I/O is performed by calling given function pointer using following
- * (*func_ptr)(c);
+ * @brief Puts the characters produced by StrFormatPrintf to the debug console.
  *
- * @param[in] func_ptr  Function to put character out.
- * @param[in] fmt       Format string for printf.
- * @param[in] ap        Arguments to printf.
+ * With the TX ring buffer the characters are written straight into its free space, they are queued when
+ * the print ends or when the ring buffer is full. Otherwise they are collected and sent in blocks.
  *
- * @return Number of characters
+ * @param[in] buf        Pointer to the debug_console_print_t of the print.
+ * @param[in] indicator  Number of characters printed so far.
+ * @param[in] dbgVal     Character to put.
+ * @param[in] len        Number of times the character is put.
  */
-static int DbgConsole_PrintfFormattedData(PUTCHAR_FUNC func_ptr, const char *fmt, va_list ap)
+static void DbgConsole_PrintCallback(char *buf, int32_t *indicator, char dbgVal, int len)
 {
-    /* va_list ap; */
-    const char *p;
-    char c;
-
-    char vstr[33];
-    char *vstrp  = NULL;
-    int32_t vlen = 0;
-
-    bool done;
-    int32_t count = 0;
-
-    uint32_t field_width;
-    uint32_t precision_width;
-    char *sval;
-    int32_t cval;
-    bool use_caps;
-    uint8_t radix = 0;
-
-#if PRINTF_ADVANCED_ENABLE
-    uint32_t flags_used;
-    char schar;
-    bool dschar;
-    long long int ival;
-    unsigned long long int uval = 0;
-    bool valid_precision_width;
-#else
-    int ival;
-    unsigned int uval = 0;
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-#if PRINTF_FLOAT_ENABLE
-    double fval;
-#endif /* PRINTF_FLOAT_ENABLE */
+    debug_console_print_t *print = (debug_console_print_t *)(void *)buf;
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+    uint32_t irqMask;
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+    int i;
 
-    /* Start parsing apart the format string and display appropriate formats and data. */
-    p = fmt;
-    while (true)
+    for (i = 0; i < len; i++)
     {
-        if ('\0' == *p)
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+        if ((0U == print->space) && print->wait)
         {
-            break;
+            /* Queue what is formatted so far and sleep until the LPUART interrupt makes space. */
+            irqMask               = DisableGlobalIRQ();
+            s_debugConsole.txHead = print->head;
+            DbgConsole_StartTxRingBuffer();
+            DbgConsole_WaitTxRingBuffer(irqMask, false);
+            print->space = (s_debugConsole.txTail + DEBUG_CONSOLE_TX_RING_BUFFER_SIZE - print->head - 1U) %
+                           DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+            EnableGlobalIRQ(irqMask);
         }
-        c = *p;
-        /*
-         * All formats begin with a '%' marker.  Special chars like
-         * '\n' or '\t' are normally converted to the appropriate
-         * character by the __compiler__.  Thus, no need for this
-         * routine to account for the '\' character.
-         */
-        if (c != '%')
+        if (0U != print->space)
         {
-            (void)func_ptr(c);
-            count++;
-            p++;
-            /* By using 'continue', the next iteration of the loop is used, skipping the code that follows. */
-            continue;
+            s_debugConsole.txRingBuffer[print->head] = (uint8_t)dbgVal;
+            print->head                              = (print->head + 1U) % DEBUG_CONSOLE_TX_RING_BUFFER_SIZE;
+            print->space--;
+            print->queued++;
         }
-
-        use_caps = true;
-
-#if PRINTF_ADVANCED_ENABLE
-        /* First check for specification modifier flags. */
-        flags_used = 0;
-        done       = false;
-        while (!done)
-        {
-            switch (*++p)
-            {
-                case '-':
-                    flags_used |= (uint32_t)kPRINTF_Minus;
-                    break;
-                case '+':
-                    flags_used |= (uint32_t)kPRINTF_Plus;
-                    break;
-                case ' ':
-                    flags_used |= (uint32_t)kPRINTF_Space;
-                    break;
-                case '0':
-                    flags_used |= (uint32_t)kPRINTF_Zero;
-                    break;
-                case '#':
-                    flags_used |= (uint32_t)kPRINTF_Pound;
-                    break;
-                default:
-                    /* We've gone one char too far. */
-                    --p;
-                    done = true;
-                    break;
-            }
-        }
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-        /* Next check for minimum field width. */
-        field_width = 0;
-        done        = false;
-        while (!done)
-        {
-            c = *++p;
-            if ((c >= '0') && (c <= '9'))
-            {
-                field_width = (field_width * 10U) + ((uint32_t)c - (uint32_t)'0');
-            }
-#if PRINTF_ADVANCED_ENABLE
-            else if (c == '*')
-            {
-                field_width = (uint32_t)va_arg(ap, unsigned int);
-            }
-#endif /* PRINTF_ADVANCED_ENABLE */
-            else
-            {
-                /* We've gone one char too far. */
-                --p;
-                done = true;
-            }
-        }
-        /* Next check for the width and precision field separator. */
-#if (PRINTF_ADVANCED_ENABLE || PRINTF_FLOAT_ENABLE)
-        precision_width = 6U; /* MISRA C-2012 Rule 2.2 */
-#endif
-#if PRINTF_ADVANCED_ENABLE
-        valid_precision_width = false;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (*++p == '.')
-        {
-            /* Must get precision field width, if present. */
-            precision_width = 0U;
-            done            = false;
-            while (!done)
-            {
-                c = *++p;
-                if ((c >= '0') && (c <= '9'))
-                {
-                    precision_width = (precision_width * 10U) + ((uint32_t)c - (uint32_t)'0');
-#if PRINTF_ADVANCED_ENABLE
-                    valid_precision_width = true;
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-#if PRINTF_ADVANCED_ENABLE
-                else if (c == '*')
-                {
-                    precision_width       = (uint32_t)va_arg(ap, unsigned int);
-                    valid_precision_width = true;
-                }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                else
-                {
-                    /* We've gone one char too far. */
-                    --p;
-                    done = true;
-                }
-            }
-        }
-        else
-        {
-            /* We've gone one char too far. */
-            --p;
-        }
-#if PRINTF_ADVANCED_ENABLE
-        /*
-         * Check for the length modifier.
-         */
-        switch (/* c = */ *++p)
-        {
-            case 'h':
-                if (*++p != 'h')
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthShortInt;
-                    --p;
-                }
-                else
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthChar;
-                }
-                break;
-            case 'l':
-                if (*++p != 'l')
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongInt;
-                    --p;
-                }
-                else
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongLongInt;
-                }
-                break;
-            case 'z':
-                if (sizeof(size_t) == sizeof(uint32_t))
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongInt;
-                }
-                else if (sizeof(size_t) == (2U * sizeof(uint32_t)))
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthLongLongInt;
-                }
-                else if (sizeof(size_t) == sizeof(uint16_t))
-                {
-                    flags_used |= (uint32_t)kPRINTF_LengthShortInt;
-                }
-                else
-                {
-                    /* MISRA C-2012 Rule 15.7 */
-                }
-                break;
-            default:
-                /* we've gone one char too far */
-                --p;
-                break;
-        }
-#endif /* PRINTF_ADVANCED_ENABLE */
-        /* Now we're ready to examine the format. */
-        c = *++p;
-        {
-            if ((c == 'd') || (c == 'i') || (c == 'f') || (c == 'F') || (c == 'x') || (c == 'X') || (c == 'o') ||
-                (c == 'b') || (c == 'p') || (c == 'u'))
-            {
-                if ((c == 'd') || (c == 'i'))
-                {
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongLongInt))
-                    {
-                        ival = (long long int)va_arg(ap, long long int);
-                    }
-                    else if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongInt))
-                    {
-                        ival = (long int)va_arg(ap, long int);
-                    }
-                    else
-#endif /* PRINTF_ADVANCED_ENABLE */
-                    {
-                        ival = (int)va_arg(ap, int);
-                    }
-                    vlen  = DbgConsole_ConvertRadixNumToString(vstr, &ival, 1, 10, use_caps);
-                    vstrp = &vstr[vlen];
-#if PRINTF_ADVANCED_ENABLE
-                    if (ival < 0)
-                    {
-                        schar = '-';
-                        ++vlen;
-                    }
-                    else
-                    {
-                        if (0U != (flags_used & (uint32_t)kPRINTF_Plus))
-                        {
-                            schar = '+';
-                            ++vlen;
-                        }
-                        else
-                        {
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Space))
-                            {
-                                schar = ' ';
-                                ++vlen;
-                            }
-                            else
-                            {
-                                schar = '\0';
-                            }
-                        }
-                    }
-                    dschar = false;
-                    /* Do the ZERO pad. */
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        if ('\0' != schar)
-                        {
-                            (void)func_ptr(schar);
-                            count++;
-                        }
-                        dschar = true;
-
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                            if ('\0' != schar)
-                            {
-                                (void)func_ptr(schar);
-                                count++;
-                            }
-                            dschar = true;
-                        }
-                    }
-                    /* The string was built in reverse order, now display in correct order. */
-                    if ((!dschar) && ('\0' != schar))
-                    {
-                        (void)func_ptr(schar);
-                        count++;
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-
-#if PRINTF_FLOAT_ENABLE
-                if ((c == 'f') || (c == 'F'))
-                {
-                    fval  = (double)va_arg(ap, double);
-                    vlen  = DbgConsole_ConvertFloatRadixNumToString(vstr, &fval, 10, precision_width);
-                    vstrp = &vstr[vlen];
-
-#if PRINTF_ADVANCED_ENABLE
-                    if (fval < 0.0)
-                    {
-                        schar = '-';
-                        ++vlen;
-                    }
-                    else
-                    {
-                        if (0U != (flags_used & (uint32_t)kPRINTF_Plus))
-                        {
-                            schar = '+';
-                            ++vlen;
-                        }
-                        else
-                        {
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Space))
-                            {
-                                schar = ' ';
-                                ++vlen;
-                            }
-                            else
-                            {
-                                schar = '\0';
-                            }
-                        }
-                    }
-                    dschar = false;
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        if ('\0' != schar)
-                        {
-                            (void)func_ptr(schar);
-                            count++;
-                        }
-                        dschar = true;
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                            if ('\0' != schar)
-                            {
-                                (void)func_ptr(schar);
-                                count++;
-                            }
-                            dschar = true;
-                        }
-                    }
-                    if ((!dschar) && ('\0' != schar))
-                    {
-                        (void)func_ptr(schar);
-                        count++;
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-#endif /* PRINTF_FLOAT_ENABLE */
-                if ((c == 'X') || (c == 'x'))
-                {
-                    if (c == 'x')
-                    {
-                        use_caps = false;
-                    }
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongLongInt))
-                    {
-                        uval = (unsigned long long int)va_arg(ap, unsigned long long int);
-                    }
-                    else if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongInt))
-                    {
-                        uval = (unsigned long int)va_arg(ap, unsigned long int);
-                    }
-                    else
-#endif /* PRINTF_ADVANCED_ENABLE */
-                    {
-                        uval = (unsigned int)va_arg(ap, unsigned int);
-                    }
-                    vlen  = DbgConsole_ConvertRadixNumToString(vstr, &uval, 0, 16, use_caps);
-                    vstrp = &vstr[vlen];
-
-#if PRINTF_ADVANCED_ENABLE
-                    dschar = false;
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        if (0U != (flags_used & (uint32_t)kPRINTF_Pound))
-                        {
-                            (void)func_ptr('0');
-                            (void)func_ptr((use_caps ? 'X' : 'x'));
-                            count += 2;
-                            /*vlen += 2;*/
-                            dschar = true;
-                        }
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Pound))
-                            {
-                                vlen += 2;
-                            }
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                            if (0U != (flags_used & (uint32_t)kPRINTF_Pound))
-                            {
-                                (void)func_ptr('0');
-                                (void)func_ptr(use_caps ? 'X' : 'x');
-                                count += 2;
-
-                                dschar = true;
-                            }
-                        }
-                    }
-
-                    if ((0U != (flags_used & (uint32_t)kPRINTF_Pound)) && (!dschar))
-                    {
-                        (void)func_ptr('0');
-                        (void)func_ptr(use_caps ? 'X' : 'x');
-                        count += 2;
-                        vlen += 2;
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-                if ((c == 'o') || (c == 'b') || (c == 'p') || (c == 'u'))
-                {
-                    if ('p' == c)
-                    {
-                        /*
-                         * Fix MISRA issue: CID 16209727 (#15 of 15): MISRA C-2012 Pointer Type Conversions (MISRA
-                         * C-2012 Rule 11.6)
-                         * 1. misra_c_2012_rule_11_6_violation: The expression va_arg (ap, void *) of type void * is
-                         * cast to type unsigned int.
-                         *
-                         * Orignal code: uval = (unsigned int)va_arg(ap, void *);
-                         */
-                        void *pval;
-                        pval = (void *)va_arg(ap, void *);
-                        (void)memcpy((void *)&uval, (void *)&pval, sizeof(void *));
-                    }
-                    else
-                    {
-#if PRINTF_ADVANCED_ENABLE
-                        if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongLongInt))
-                        {
-                            uval = (unsigned long long int)va_arg(ap, unsigned long long int);
-                        }
-                        else if (0U != (flags_used & (uint32_t)kPRINTF_LengthLongInt))
-                        {
-                            uval = (unsigned long int)va_arg(ap, unsigned long int);
-                        }
-                        else
-#endif /* PRINTF_ADVANCED_ENABLE */
-                        {
-                            uval = (unsigned int)va_arg(ap, unsigned int);
-                        }
-                    }
-                    switch (c)
-                    {
-                        case 'o':
-                            radix = 8;
-                            break;
-                        case 'b':
-                            radix = 2;
-                            break;
-                        case 'p':
-                            radix = 16;
-                            break;
-                        case 'u':
-                            radix = 10;
-                            break;
-                        default:
-                            /* MISRA C-2012 Rule 16.4 */
-                            break;
-                    }
-                    vlen  = DbgConsole_ConvertRadixNumToString(vstr, &uval, 0, (int32_t)radix, use_caps);
-                    vstrp = &vstr[vlen];
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
-                    {
-                        DbgConsole_PrintfPaddingCharacter('0', vlen, (int32_t)field_width, &count, func_ptr);
-                        vlen = (int32_t)field_width;
-                    }
-                    else
-                    {
-                        if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-                        {
-                            DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                        }
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-#if !PRINTF_ADVANCED_ENABLE
-                DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-#endif /* !PRINTF_ADVANCED_ENABLE */
-                if (vstrp != NULL)
-                {
-                    while ('\0' != *vstrp)
-                    {
-                        (void)func_ptr(*vstrp--);
-                        count++;
-                    }
-                }
-#if PRINTF_ADVANCED_ENABLE
-                if (0U != (flags_used & (uint32_t)kPRINTF_Minus))
-                {
-                    DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                }
-#endif /* PRINTF_ADVANCED_ENABLE */
-            }
-            else if (c == 'c')
-            {
-                cval = (int32_t)va_arg(ap, unsigned int);
-                (void)func_ptr(cval);
-                count++;
-            }
-            else if (c == 's')
-            {
-                sval = (char *)va_arg(ap, char *);
-                if (NULL != sval)
-                {
-#if PRINTF_ADVANCED_ENABLE
-                    if (valid_precision_width)
-                    {
-                        vlen = (int32_t)precision_width;
-                    }
-                    else
-                    {
-                        vlen = (int32_t)strlen(sval);
-                    }
 #else
-                    vlen = (int32_t)strlen(sval);
-#endif /* PRINTF_ADVANCED_ENABLE */
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U == (flags_used & (uint32_t)kPRINTF_Minus))
-#endif /* PRINTF_ADVANCED_ENABLE */
-                    {
-                        DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                    }
-
-#if PRINTF_ADVANCED_ENABLE
-                    if (valid_precision_width)
-                    {
-                        while (('\0' != *sval) && (vlen > 0))
-                        {
-                            (void)func_ptr(*sval++);
-                            count++;
-                            vlen--;
-                        }
-                        /* In case that vlen sval is shorter than vlen */
-                        vlen = (int32_t)precision_width - vlen;
-                    }
-                    else
-                    {
-#endif /* PRINTF_ADVANCED_ENABLE */
-                        while ('\0' != *sval)
-                        {
-                            (void)func_ptr(*sval++);
-                            count++;
-                        }
-#if PRINTF_ADVANCED_ENABLE
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-
-#if PRINTF_ADVANCED_ENABLE
-                    if (0U != (flags_used & (uint32_t)kPRINTF_Minus))
-                    {
-                        DbgConsole_PrintfPaddingCharacter(' ', vlen, (int32_t)field_width, &count, func_ptr);
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
-                }
-            }
-            else
-            {
-                (void)func_ptr(c);
-                count++;
-            }
+        print->data[print->length] = (uint8_t)dbgVal;
+        print->length++;
+        if (DEBUG_CONSOLE_PRINTF_BUFFER_SIZE == print->length)
+        {
+            (void)s_debugConsole.putChar((hal_uart_handle_t)&s_debugConsole.uartHandleBuffer[0], print->data,
+                                         print->length);
+            print->length = 0U;
         }
-        p++;
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+        (*indicator)++;
     }
-    return count;
 }
 
 #endif /* SDK_DEBUGCONSOLE */
 
+#if (DEBUG_CONSOLE_LOG_LEVEL > DEBUG_CONSOLE_LOG_LEVEL_NONE)
+/* See fsl_debug_console.h for documentation of this function. */
+void DbgConsole_SetLogFilter(uint32_t levelMask, uint32_t moduleMask)
+{
+    g_dbgConsoleLogLevelMask  = levelMask;
+    g_dbgConsoleLogModuleMask = moduleMask;
+}
+#endif /* DEBUG_CONSOLE_LOG_LEVEL */
+
 /*************Code to support toolchain's printf, scanf *******************************/
 /* These function __write and __read is used to support IAR toolchain to printf and scanf*/
 #if (defined(__ICCARM__))
@@ -54,6 +54,16 @@
 #define PRINTF_FLOAT_ENABLE 0U
 #endif /* PRINTF_FLOAT_ENABLE */
 
+/*! @brief Definition to printf the float number with fixed-point math, see fsl_str.h. */
+#ifndef PRINTF_FLOAT_FIXED_POINT_ENABLE
+#define PRINTF_FLOAT_FIXED_POINT_ENABLE 1U
+#endif /* PRINTF_FLOAT_FIXED_POINT_ENABLE */
+
+/*! @brief Definition to printf every float number exactly with the fixed-point math, see fsl_str.h. */
+#ifndef PRINTF_FLOAT_EXACT_ENABLE
+#define PRINTF_FLOAT_EXACT_ENABLE 0U
+#endif /* PRINTF_FLOAT_EXACT_ENABLE */
+
 /*! @brief Definition to scanf the float number. */
 #ifndef SCANF_FLOAT_ENABLE
 #define SCANF_FLOAT_ENABLE 0U
@@ -69,6 +79,45 @@
 #define SCANF_ADVANCED_ENABLE 0U
 #endif /* SCANF_ADVANCED_ENABLE */
 
+/*! @brief Definition to receive the debug console input through an interrupt driven LPUART RX ring buffer.
+ *
+ *  When enabled, DbgConsole_Getchar waits for input with the core in sleep instead of polling the UART,
+ *  and DbgConsole_StartLineInput can be used to get complete command lines asynchronously.
+ */
+#ifndef DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE
+#define DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE 0U
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
+
+/*! @brief Size of the debug console RX ring buffer, one byte is reserved by the LPUART driver. */
+#ifndef DEBUG_CONSOLE_RX_RING_BUFFER_SIZE
+#define DEBUG_CONSOLE_RX_RING_BUFFER_SIZE 64U
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_SIZE */
+
+/*! @brief Maximum length of a command line assembled by the debug console, without the end of string char. */
+#ifndef DEBUG_CONSOLE_RX_LINE_SIZE
+#define DEBUG_CONSOLE_RX_LINE_SIZE 32U
+#endif /* DEBUG_CONSOLE_RX_LINE_SIZE */
+
+/*! @brief Definition to send the debug console output through an interrupt driven LPUART TX ring buffer.
+ *
+ *  When enabled, DbgConsole_Printf formats straight into the ring buffer and returns once the output is
+ *  queued, the core only waits, in sleep, while the ring buffer is full. Call DbgConsole_Flush before
+ *  the UART clock is stopped.
+ */
+#ifndef DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE
+#define DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE 0U
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
+/*! @brief Size of the debug console TX ring buffer, one byte is left unused to tell a full buffer from an empty one. */
+#ifndef DEBUG_CONSOLE_TX_RING_BUFFER_SIZE
+#define DEBUG_CONSOLE_TX_RING_BUFFER_SIZE 256U
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_SIZE */
+
+/*! @brief Characters DbgConsole_Printf collects on the stack before sending them, without the TX ring buffer. */
+#ifndef DEBUG_CONSOLE_PRINTF_BUFFER_SIZE
+#define DEBUG_CONSOLE_PRINTF_BUFFER_SIZE 32U
+#endif /* DEBUG_CONSOLE_PRINTF_BUFFER_SIZE */
+
 /*! @brief Definition to select redirect toolchain printf, scanf to uart or not.
  *
  *  if SDK_DEBUGCONSOLE defined to 0,it represents select toolchain printf, scanf.
@@ -96,6 +145,61 @@ static inline int DbgConsole_Disabled(void)
 #define PUTCHAR putchar
 #define GETCHAR getchar
 #endif /* SDK_DEBUGCONSOLE */
+
+/*! @brief Log levels, a message is printed if its level is less than or equal to DEBUG_CONSOLE_LOG_LEVEL. */
+#define DEBUG_CONSOLE_LOG_LEVEL_NONE  0U /*!< No log message. */
+#define DEBUG_CONSOLE_LOG_LEVEL_ERROR 1U /*!< Errors. */
+#define DEBUG_CONSOLE_LOG_LEVEL_WARN  2U /*!< Warnings, for example invalid user input. */
+#define DEBUG_CONSOLE_LOG_LEVEL_INFO  3U /*!< Normal operation messages, for example menus. */
+#define DEBUG_CONSOLE_LOG_LEVEL_DEBUG 4U /*!< Verbose diagnostics. */
+
+/*! @brief Definition to select the highest log level built in.
+ *
+ *  The DBG_LOG macros of the levels above it expand to nothing, the format strings and the
+ *  arguments are not compiled, so the arguments must not have side effects.
+ */
+#ifndef DEBUG_CONSOLE_LOG_LEVEL
+#define DEBUG_CONSOLE_LOG_LEVEL DEBUG_CONSOLE_LOG_LEVEL_DEBUG
+#endif /* DEBUG_CONSOLE_LOG_LEVEL */
+
+/*! @brief Runtime filter mask bit of a log level. */
+#define DBG_LOG_LEVEL_MASK(level) (1UL << (level))
+/*! @brief Runtime filter mask bit of a log module tag, the module tag is a number from 0 to 31. */
+#define DBG_LOG_MODULE_MASK(module) (1UL << (module))
+
+#if (DEBUG_CONSOLE_LOG_LEVEL > DEBUG_CONSOLE_LOG_LEVEL_NONE)
+/*! @brief Prints a log message if both its level and its module tag are enabled by DbgConsole_SetLogFilter. */
+#define DBG_LOG_PRINT(level, module, ...)                                           \
+    do                                                                              \
+    {                                                                               \
+        if ((0U != (g_dbgConsoleLogLevelMask & DBG_LOG_LEVEL_MASK(level))) &&       \
+            (0U != (g_dbgConsoleLogModuleMask & DBG_LOG_MODULE_MASK(module))))      \
+        {                                                                           \
+            (void)PRINTF(__VA_ARGS__);                                              \
+        }                                                                           \
+    } while (false)
+#endif /* DEBUG_CONSOLE_LOG_LEVEL */
+
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_ERROR)
+#define DBG_LOG_ERROR(module, ...) DBG_LOG_PRINT(DEBUG_CONSOLE_LOG_LEVEL_ERROR, (module), __VA_ARGS__)
+#else
+#define DBG_LOG_ERROR(module, ...) ((void)0)
+#endif
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_WARN)
+#define DBG_LOG_WARN(module, ...) DBG_LOG_PRINT(DEBUG_CONSOLE_LOG_LEVEL_WARN, (module), __VA_ARGS__)
+#else
+#define DBG_LOG_WARN(module, ...) ((void)0)
+#endif
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_INFO)
+#define DBG_LOG_INFO(module, ...) DBG_LOG_PRINT(DEBUG_CONSOLE_LOG_LEVEL_INFO, (module), __VA_ARGS__)
+#else
+#define DBG_LOG_INFO(module, ...) ((void)0)
+#endif
+#if (DEBUG_CONSOLE_LOG_LEVEL >= DEBUG_CONSOLE_LOG_LEVEL_DEBUG)
+#define DBG_LOG_DEBUG(module, ...) DBG_LOG_PRINT(DEBUG_CONSOLE_LOG_LEVEL_DEBUG, (module), __VA_ARGS__)
+#else
+#define DBG_LOG_DEBUG(module, ...) ((void)0)
+#endif
 /*! @} */
 
 /*! @brief serial port type
@@ -119,6 +223,22 @@ typedef enum _serial_port_type
 } serial_port_type_t;
 #endif
 
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+/*! @brief Debug console line input callback.
+ *
+ *  Called in the LPUART interrupt context when a complete command line is received. The line is
+ *  terminated by '\0' and does not include the end of line characters, it is valid only during the call.
+ */
+typedef void (*dbg_console_line_callback_t)(const char *line, size_t length, void *userData);
+
+/*! @brief Debug console packet input callback.
+ *
+ *  Called in the LPUART interrupt context when the line gets idle after a receive burst. The packet
+ *  is the binary data of the burst, it is valid only during the call.
+ */
+typedef void (*dbg_console_packet_callback_t)(const uint8_t *packet, size_t length, void *userData);
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
+
 /*!
  * @addtogroup debugconsolelite
  * @{
@@ -187,6 +307,17 @@ status_t DbgConsole_EnterLowpower(void);
  */
 status_t DbgConsole_ExitLowpower(void);
 
+/*!
+ * @brief Waits until all the debug console output is sent out.
+ *
+ * With DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE the core sleeps until the TX ring buffer is empty and the last
+ * character is shifted out, or sends the rest itself when called with interrupts masked. Without the ring
+ * buffer every output function already returns after the data is sent out.
+ *
+ * @return Indicates whether the flush was successful or not.
+ */
+status_t DbgConsole_Flush(void);
+
 #else
 /*!
  * Use an error to replace the DbgConsole_Init when SDK_DEBUGCONSOLE is not DEBUGCONSOLE_REDIRECT_TO_SDK and
@@ -230,6 +361,15 @@ static inline status_t DbgConsole_ExitLowpower(void)
     return (status_t)kStatus_Fail;
 }
 
+/*!
+ * Use an error to replace the DbgConsole_Flush when SDK_DEBUGCONSOLE is not DEBUGCONSOLE_REDIRECT_TO_SDK and
+ * SDK_DEBUGCONSOLE_UART is not defined.
+ */
+static inline status_t DbgConsole_Flush(void)
+{
+    return (status_t)kStatus_Fail;
+}
+
 #endif /* ((SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK) || defined(SDK_DEBUGCONSOLE_UART)) */
 
 #if (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
@@ -248,12 +388,47 @@ int DbgConsole_Printf(const char *fmt_s, ...);
  *
  * Call this function to write a formatted output to the standard output stream.
  *
+ * With DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE the output is formatted straight into the TX ring buffer,
+ * queued with one critical section and one TX start unless the ring buffer fills up, in which case
+ * the core sleeps until there is space. A print from an interrupt preempting another print is not
+ * interleaved into the ring buffer, it is dropped and returns a negative value. Without the ring
+ * buffer the output is sent in blocks of up to DEBUG_CONSOLE_PRINTF_BUFFER_SIZE characters.
+ *
  * @param   fmt_s Format control string.
  * @param   formatStringArg Format arguments.
  * @return  Returns the number of characters printed or a negative value if an error occurs.
  */
 int DbgConsole_Vprintf(const char *fmt_s, va_list formatStringArg);
 
+#if (defined(DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE > 0U))
+/*!
+ * @brief Writes formatted output to the TX ring buffer without waiting for space.
+ *
+ * The output is formatted straight into the free space of the TX ring buffer and queued with one
+ * critical section and one TX start, so a frame is built in place without a copy. The function never
+ * waits: like StrFormatVsnprintf, the output is cut at the free space and the return value is the
+ * length of the complete output, so the output is truncated if it is greater than the number of
+ * characters queued. A print from an interrupt preempting another print queues nothing.
+ *
+ * @param   queued Returns the number of characters queued, can be NULL.
+ * @param   fmt_s Format control string.
+ * @param   formatStringArg Format arguments.
+ * @return  Returns the number of characters of the complete output or a negative value if an error occurs.
+ */
+int DbgConsole_TryVprintf(size_t *queued, const char *fmt_s, va_list formatStringArg);
+
+/*!
+ * @brief Writes formatted output to the TX ring buffer without waiting for space.
+ *
+ * See DbgConsole_TryVprintf for the details.
+ *
+ * @param   queued Returns the number of characters queued, can be NULL.
+ * @param   fmt_s Format control string.
+ * @return  Returns the number of characters of the complete output or a negative value if an error occurs.
+ */
+int DbgConsole_TryPrintf(size_t *queued, const char *fmt_s, ...);
+#endif /* DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE */
+
 /*!
  * @brief Writes a character to stdout.
  *
@@ -264,6 +439,20 @@ int DbgConsole_Vprintf(const char *fmt_s, va_list formatStringArg);
  */
 int DbgConsole_Putchar(int dbgConsoleCh);
 
+/*!
+ * @brief Writes a block of data to stdout.
+ *
+ * Call this function to send data that is already formatted, for example a frame built in place
+ * with StrFormatSnprintf, in one transfer instead of formatting it again with DbgConsole_Printf.
+ * With DEBUG_CONSOLE_TX_RING_BUFFER_ENABLE the data is copied into the TX ring buffer and the
+ * function returns once it is queued.
+ *
+ * @param   data   Data to be written.
+ * @param   length Number of bytes to be written.
+ * @return  Returns the number of bytes written or a negative value if an error occurs.
+ */
+int DbgConsole_SendData(const uint8_t *data, size_t length);
+
 /*!
  * @brief Reads formatted data from the standard input stream.
  *
@@ -283,8 +472,74 @@ int DbgConsole_Scanf(char *fmt_s, ...);
  */
 int DbgConsole_Getchar(void);
 
+#if (defined(DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE) && (DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE > 0U))
+/*!
+ * @brief Starts asynchronous line input.
+ *
+ * Call this function to assemble the received characters into command lines in the background.
+ * The received data is processed at the end of each receive burst (idle line), a line ends
+ * with '\r' or '\n', and a line longer than DEBUG_CONSOLE_RX_LINE_SIZE is delivered in pieces.
+ * The core can stay in sleep until the callback is invoked. While line input is active,
+ * DbgConsole_Getchar returns -1.
+ *
+ * @param   callback Callback invoked when a complete command line is received.
+ * @param   userData Parameter passed to the callback.
+ * @retval kStatus_Success          Line input started.
+ * @retval kStatus_Fail             The debug console is not initialized, or packet input is active.
+ */
+status_t DbgConsole_StartLineInput(dbg_console_line_callback_t callback, void *userData);
+
+/*!
+ * @brief Stops asynchronous line input.
+ *
+ * The partially received line is discarded, and the following input can be read by DbgConsole_Getchar.
+ */
+void DbgConsole_StopLineInput(void);
+
+/*!
+ * @brief Starts asynchronous packet input.
+ *
+ * Call this function to receive binary packets delimited by the idle line, for example commands
+ * sent by a host script. The RX interrupt is raised once per half FIFO, and each receive burst
+ * is passed to the callback as one packet, in place when it does not wrap around the end of the
+ * RX ring buffer. A packet longer than DEBUG_CONSOLE_RX_RING_BUFFER_SIZE - 1 is dropped. While
+ * packet input is active, DbgConsole_Getchar returns -1.
+ *
+ * @param   callback Callback invoked when a packet is received.
+ * @param   userData Parameter passed to the callback.
+ * @retval kStatus_Success          Packet input started.
+ * @retval kStatus_Fail             The debug console is not initialized, or line input is active.
+ */
+status_t DbgConsole_StartPacketInput(dbg_console_packet_callback_t callback, void *userData);
+
+/*!
+ * @brief Stops asynchronous packet input.
+ *
+ * The following input can be read by DbgConsole_Getchar.
+ */
+void DbgConsole_StopPacketInput(void);
+#endif /* DEBUG_CONSOLE_RX_RING_BUFFER_ENABLE */
+
 #endif /* SDK_DEBUGCONSOLE */
 
+#if (DEBUG_CONSOLE_LOG_LEVEL > DEBUG_CONSOLE_LOG_LEVEL_NONE)
+/*! @brief Log levels enabled at runtime, see DBG_LOG_LEVEL_MASK. Use DbgConsole_SetLogFilter to change it. */
+extern volatile uint32_t g_dbgConsoleLogLevelMask;
+/*! @brief Log module tags enabled at runtime, see DBG_LOG_MODULE_MASK. Use DbgConsole_SetLogFilter to change it. */
+extern volatile uint32_t g_dbgConsoleLogModuleMask;
+
+/*!
+ * @brief Sets the runtime log filter.
+ *
+ * A message of the DBG_LOG macros is printed only if both its level and its module tag are enabled.
+ * All built in levels and all module tags are enabled by default.
+ *
+ * @param levelMask  Enabled levels, OR'ed DBG_LOG_LEVEL_MASK values.
+ * @param moduleMask Enabled module tags, OR'ed DBG_LOG_MODULE_MASK values.
+ */
+void DbgConsole_SetLogFilter(uint32_t levelMask, uint32_t moduleMask);
+#endif /* DEBUG_CONSOLE_LOG_LEVEL */
+
 /*! @} */
 
 #if defined(__cplusplus)
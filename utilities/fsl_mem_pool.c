@@ -0,0 +1,133 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_mem_pool.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* See fsl_mem_pool.h for documentation of this function. */
+status_t MemPool_Init(mem_pool_t *pool,
+                      void *storage,
+                      size_t storageSize,
+                      const mem_pool_class_config_t *config,
+                      uint32_t classCount)
+{
+    mem_pool_class_t *poolClass;
+    uint8_t *block = (uint8_t *)storage;
+    uint8_t *storageEnd;
+    uint32_t blockSize;
+    uint32_t i;
+    uint32_t j;
+
+    assert((NULL != pool) && (NULL != storage) && (NULL != config));
+
+    if ((0U == classCount) || (classCount > MEM_POOL_CLASS_COUNT) ||
+        (0U != ((uintptr_t)storage & (MEM_POOL_BLOCK_ALIGNMENT - 1U))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    storageEnd = block + storageSize;
+    for (i = 0U; i < classCount; i++)
+    {
+        blockSize = SDK_SIZEALIGN(MAX(config[i].blockSize, sizeof(void *)), MEM_POOL_BLOCK_ALIGNMENT);
+        if (((i > 0U) && (blockSize < pool->classes[i - 1U].blockSize)) ||
+            ((uint32_t)(storageEnd - block) / blockSize < config[i].blockCount))
+        {
+            return kStatus_InvalidArgument;
+        }
+
+        poolClass               = &pool->classes[i];
+        poolClass->freeList     = NULL;
+        poolClass->start        = block;
+        poolClass->blockSize    = blockSize;
+        poolClass->freeCount    = config[i].blockCount;
+        poolClass->minFreeCount = config[i].blockCount;
+
+        /* Link the blocks from the last one, so that the first allocation gets the lowest address. */
+        block += blockSize * config[i].blockCount;
+        poolClass->end = block;
+        for (j = 0U; j < config[i].blockCount; j++)
+        {
+            *(void **)(void *)(block - (blockSize * (j + 1U))) = poolClass->freeList;
+            poolClass->freeList = block - (blockSize * (j + 1U));
+        }
+    }
+    pool->classCount = classCount;
+
+    return kStatus_Success;
+}
+
+/* See fsl_mem_pool.h for documentation of this function. */
+void *MemPool_Alloc(mem_pool_t *pool, size_t size)
+{
+    mem_pool_class_t *poolClass;
+    void *block = NULL;
+    uint32_t irqMask;
+    uint32_t i;
+
+    assert(NULL != pool);
+
+    irqMask = DisableGlobalIRQ();
+
+    for (i = 0U; i < pool->classCount; i++)
+    {
+        poolClass = &pool->classes[i];
+        if ((size <= poolClass->blockSize) && (NULL != poolClass->freeList))
+        {
+            block               = poolClass->freeList;
+            poolClass->freeList = *(void **)block;
+            poolClass->freeCount--;
+            if (poolClass->freeCount < poolClass->minFreeCount)
+            {
+                poolClass->minFreeCount = poolClass->freeCount;
+            }
+            break;
+        }
+    }
+
+    EnableGlobalIRQ(irqMask);
+
+    return block;
+}
+
+/* See fsl_mem_pool.h for documentation of this function. */
+void MemPool_Free(mem_pool_t *pool, void *block)
+{
+    mem_pool_class_t *poolClass;
+    uint32_t irqMask;
+    uint32_t i;
+
+    assert(NULL != pool);
+
+    if (NULL == block)
+    {
+        return;
+    }
+
+    irqMask = DisableGlobalIRQ();
+
+    for (i = 0U; i < pool->classCount; i++)
+    {
+        poolClass = &pool->classes[i];
+        if (((uint8_t *)block >= poolClass->start) && ((uint8_t *)block < poolClass->end))
+        {
+            assert(0U == ((uintptr_t)((uint8_t *)block - poolClass->start) % poolClass->blockSize));
+
+            *(void **)block     = poolClass->freeList;
+            poolClass->freeList = block;
+            poolClass->freeCount++;
+            break;
+        }
+    }
+
+    /* The block does not belong to the pool. */
+    assert(i < pool->classCount);
+
+    EnableGlobalIRQ(irqMask);
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_MEM_POOL_H_
+#define _FSL_MEM_POOL_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup mem_pool
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of size classes of a pool. */
+#ifndef MEM_POOL_CLASS_COUNT
+#define MEM_POOL_CLASS_COUNT 4U
+#endif /* MEM_POOL_CLASS_COUNT */
+
+/*! @brief Alignment of the blocks, the block sizes are rounded up to it. */
+#ifndef MEM_POOL_BLOCK_ALIGNMENT
+#define MEM_POOL_BLOCK_ALIGNMENT 4U
+#endif /* MEM_POOL_BLOCK_ALIGNMENT */
+
+/*!
+ * @brief Defines the storage of a pool.
+ *
+ * The storage can be pinned to a RAM bank with a section attribute, for example
+ * RETAINED_DATA_RAMX of fsl_retained_data.h, so that the driver states allocated from the pool
+ * are in one retainable region.
+ *
+ * @param name Name of the storage array.
+ * @param size Size of the storage in bytes, see MEM_POOL_CLASS_SIZE.
+ */
+#define MEM_POOL_STORAGE_DEFINE(name, size) \
+    uint32_t name[((size) + sizeof(uint32_t) - 1U) / sizeof(uint32_t)] __attribute__((aligned(MEM_POOL_BLOCK_ALIGNMENT)))
+
+/*! @brief Bytes of storage taken by a size class. */
+#define MEM_POOL_CLASS_SIZE(blockSize, blockCount) \
+    (SDK_SIZEALIGN((blockSize), MEM_POOL_BLOCK_ALIGNMENT) * (blockCount))
+
+/*! @brief Configuration of a size class. */
+typedef struct _mem_pool_class_config
+{
+    uint32_t blockSize;  /*!< Size of the blocks in bytes, at least the size of a pointer. */
+    uint32_t blockCount; /*!< Number of blocks. */
+} mem_pool_class_config_t;
+
+/*! @brief Size class state, internal use only. */
+typedef struct _mem_pool_class
+{
+    void *freeList;        /*!< Free blocks, linked through their first word. */
+    uint8_t *start;        /*!< Start address of the blocks. */
+    uint8_t *end;          /*!< End address of the blocks. */
+    uint32_t blockSize;    /*!< Size of the blocks in bytes. */
+    uint32_t freeCount;    /*!< Number of free blocks. */
+    uint32_t minFreeCount; /*!< Lowest number of free blocks since initialization. */
+} mem_pool_class_t;
+
+/*! @brief Pool state. */
+typedef struct _mem_pool
+{
+    mem_pool_class_t classes[MEM_POOL_CLASS_COUNT]; /*!< Size classes, by increasing block size. */
+    uint32_t classCount;                            /*!< Number of size classes. */
+} mem_pool_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initializes a pool.
+ *
+ * The storage is split into the size classes in the configuration order, which must be by
+ * increasing block size.
+ *
+ * @param pool Pool state.
+ * @param storage Storage of the blocks, aligned to MEM_POOL_BLOCK_ALIGNMENT.
+ * @param storageSize Size of the storage in bytes.
+ * @param config Size class configurations.
+ * @param classCount Number of size classes, up to MEM_POOL_CLASS_COUNT.
+ * @retval kStatus_Success The pool is initialized.
+ * @retval kStatus_InvalidArgument The configuration is not valid or the storage is too small.
+ */
+status_t MemPool_Init(mem_pool_t *pool,
+                      void *storage,
+                      size_t storageSize,
+                      const mem_pool_class_config_t *config,
+                      uint32_t classCount);
+
+/*!
+ * @brief Allocates a block.
+ *
+ * The block is taken from the smallest size class that fits and has a free block. The time does
+ * not depend on the number of blocks, and the function can be called in interrupt handlers.
+ *
+ * @param pool Pool state.
+ * @param size Size required in bytes.
+ * @return The block, or NULL if no block is available.
+ */
+void *MemPool_Alloc(mem_pool_t *pool, size_t size);
+
+/*!
+ * @brief Frees a block.
+ *
+ * @param pool Pool state.
+ * @param block Block allocated from the pool, NULL is ignored.
+ */
+void MemPool_Free(mem_pool_t *pool, void *block);
+
+/*!
+ * @brief Gets the lowest number of free blocks of a size class since initialization.
+ *
+ * Use it to size the pool: a size class that always keeps free blocks can be made smaller.
+ *
+ * @param pool Pool state.
+ * @param classIndex Size class index.
+ * @return Lowest number of free blocks.
+ */
+static inline uint32_t MemPool_GetMinFreeCount(const mem_pool_t *pool, uint32_t classIndex)
+{
+    assert(classIndex < pool->classCount);
+
+    return pool->classes[classIndex].minFreeCount;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_MEM_POOL_H_ */
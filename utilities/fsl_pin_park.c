@@ -0,0 +1,199 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pin_park.h"
+#include "fsl_port.h"
+#include "fsl_reset.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of pins of a PORT instance. */
+#define PIN_PARK_PIN_COUNT 32U
+
+/*! @brief PCR fields that make a pin leak, a pin without them is already parked. */
+#define PIN_PARK_LEAKAGE_MASK (PORT_PCR_MUX_MASK | PORT_PCR_IBE_MASK | PORT_PCR_PE_MASK)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/*!
+ * @brief Enables the clock of a PORT instance.
+ *
+ * @param port PORT instance index.
+ * @return true if the clock was already enabled.
+ */
+static bool PinPark_EnablePortClock(uint32_t port);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static PORT_Type *const s_portBases[]       = PORT_BASE_PTRS;
+static const clock_ip_name_t s_portClocks[] = {kCLOCK_GatePORT0, kCLOCK_GatePORT1, kCLOCK_GatePORT2, kCLOCK_GatePORT3,
+                                               kCLOCK_GatePORT4};
+static const reset_ip_name_t s_portResets[] = PORT_RSTS_N;
+static const uint32_t s_reservedPins[]      = PIN_PARK_RESERVED_PINS;
+
+/* Lowest leakage state: GPIO, input buffer and pull resistor disabled. */
+static const port_pin_config_t s_parkConfig = {kPORT_PullDisable,
+                                               kPORT_LowPullResistor,
+                                               kPORT_FastSlewRate,
+                                               kPORT_PassiveFilterDisable,
+                                               kPORT_OpenDrainDisable,
+                                               kPORT_LowDriveStrength,
+                                               kPORT_NormalDriveStrength,
+                                               kPORT_MuxAsGpio,
+                                               kPORT_InputBufferDisable,
+                                               kPORT_InputNormal,
+                                               kPORT_UnlockRegister};
+
+static uint32_t s_ownedPins[PIN_PARK_PORT_COUNT];  /* Pins that are not parked. */
+static uint32_t s_parkedPins[PIN_PARK_PORT_COUNT]; /* Pins parked by the last PinPark_Park. */
+static uint16_t s_savedPcr[PIN_PARK_PORT_COUNT][PIN_PARK_PIN_COUNT]; /* PCR[15:0] of the parked pins. */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static bool PinPark_EnablePortClock(uint32_t port)
+{
+    /* The PORT clock gates are in MRCC_GLB_CC1. */
+    bool enabled = (0U != (MRCC0->MRCC_GLB_CC1 & (1UL << CLK_GATE_BIT_SHIFT(s_portClocks[port]))));
+
+    if (!enabled)
+    {
+        CLOCK_EnableClock(s_portClocks[port]);
+    }
+
+    return enabled;
+}
+
+/* See fsl_pin_park.h for documentation of this function. */
+void PinPark_Init(void)
+{
+    uint32_t port;
+
+    for (port = 0U; port < PIN_PARK_PORT_COUNT; port++)
+    {
+        s_ownedPins[port]  = s_reservedPins[port];
+        s_parkedPins[port] = 0U;
+    }
+}
+
+/* See fsl_pin_park.h for documentation of this function. */
+void PinPark_ClaimPins(uint32_t port, uint32_t mask)
+{
+    uint32_t irqMask;
+
+    assert(port < PIN_PARK_PORT_COUNT);
+
+    irqMask = DisableGlobalIRQ();
+    s_ownedPins[port] |= mask;
+    EnableGlobalIRQ(irqMask);
+}
+
+/* See fsl_pin_park.h for documentation of this function. */
+void PinPark_ReleasePins(uint32_t port, uint32_t mask)
+{
+    uint32_t irqMask;
+
+    assert(port < PIN_PARK_PORT_COUNT);
+
+    irqMask = DisableGlobalIRQ();
+    s_ownedPins[port] = (s_ownedPins[port] & ~mask) | s_reservedPins[port];
+    EnableGlobalIRQ(irqMask);
+}
+
+/* See fsl_pin_park.h for documentation of this function. */
+uint32_t PinPark_Park(void)
+{
+    PORT_Type *base;
+    uint32_t parkedCount = 0U;
+    uint32_t port;
+    uint32_t pin;
+    uint32_t pcr;
+    uint32_t mask;
+    bool clockEnabled;
+
+    for (port = 0U; port < PIN_PARK_PORT_COUNT; port++)
+    {
+        s_parkedPins[port] = 0U;
+
+        /* A PORT held in reset keeps its pins in the reset state, with the input buffers disabled.
+           The PORT reset bits are in MRCC_GLB_RST1. */
+        if (0U == (MRCC0->MRCC_GLB_RST1 & (1UL << ((uint32_t)s_portResets[port] & 0xFFU))))
+        {
+            continue;
+        }
+
+        base         = s_portBases[port];
+        clockEnabled = PinPark_EnablePortClock(port);
+
+        mask = 0U;
+        for (pin = 0U; pin < PIN_PARK_PIN_COUNT; pin++)
+        {
+            if (0U != (s_ownedPins[port] & (1UL << pin)))
+            {
+                continue;
+            }
+            pcr = base->PCR[pin];
+            if ((0U == (pcr & PORT_PCR_LK_MASK)) && (0U != (pcr & PIN_PARK_LEAKAGE_MASK)))
+            {
+                s_savedPcr[port][pin] = (uint16_t)pcr;
+                mask |= (1UL << pin);
+                parkedCount++;
+            }
+        }
+
+        /* Park all the pins of the PORT with the global pin control registers. */
+        if (0U != mask)
+        {
+            PORT_SetMultiplePinsConfig(base, mask, &s_parkConfig);
+            s_parkedPins[port] = mask;
+        }
+
+        if (!clockEnabled)
+        {
+            CLOCK_DisableClock(s_portClocks[port]);
+        }
+    }
+
+    return parkedCount;
+}
+
+/* See fsl_pin_park.h for documentation of this function. */
+void PinPark_Restore(void)
+{
+    uint32_t port;
+    uint32_t pin;
+    bool clockEnabled;
+
+    for (port = 0U; port < PIN_PARK_PORT_COUNT; port++)
+    {
+        if (0U == s_parkedPins[port])
+        {
+            continue;
+        }
+
+        clockEnabled = PinPark_EnablePortClock(port);
+
+        for (pin = 0U; pin < PIN_PARK_PIN_COUNT; pin++)
+        {
+            if (0U != (s_parkedPins[port] & (1UL << pin)))
+            {
+                PORT_SetPinConfig(s_portBases[port], pin,
+                                  (const port_pin_config_t *)(const void *)&s_savedPcr[port][pin]);
+            }
+        }
+        s_parkedPins[port] = 0U;
+
+        if (!clockEnabled)
+        {
+            CLOCK_DisableClock(s_portClocks[port]);
+        }
+    }
+}
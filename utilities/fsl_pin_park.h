@@ -0,0 +1,95 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PIN_PARK_H_
+#define _FSL_PIN_PARK_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup pin_park
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of PORT instances managed, PORT0 to PORT4. */
+#define PIN_PARK_PORT_COUNT FSL_FEATURE_SOC_PORT_COUNT
+
+/*!
+ * @brief Pins that are never parked, one mask per PORT instance.
+ *
+ * The default keeps the SWD pins P0_0 and P0_1, so that the debugger stays attached, and the
+ * RESET_b pin P1_29.
+ */
+#ifndef PIN_PARK_RESERVED_PINS
+#define PIN_PARK_RESERVED_PINS                                          \
+    {                                                                   \
+        0x00000003U, 0x20000000U, 0x00000000U, 0x00000000U, 0x00000000U \
+    }
+#endif /* PIN_PARK_RESERVED_PINS */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initializes the pin ownership, only the reserved pins are owned.
+ */
+void PinPark_Init(void);
+
+/*!
+ * @brief Claims pins for a driver, the claimed pins are not parked.
+ *
+ * Claim the pins whose state must be kept in low power modes, for example the pins of a
+ * peripheral that wakes up the device, or the pins that the driver reconfigures itself.
+ *
+ * @param port PORT instance index, 0 for PORT0.
+ * @param mask Mask of the pins.
+ */
+void PinPark_ClaimPins(uint32_t port, uint32_t mask);
+
+/*!
+ * @brief Releases pins claimed with PinPark_ClaimPins.
+ *
+ * @param port PORT instance index, 0 for PORT0.
+ * @param mask Mask of the pins.
+ */
+void PinPark_ReleasePins(uint32_t port, uint32_t mask);
+
+/*!
+ * @brief Parks the pins that are not owned.
+ *
+ * The pins are saved and set to GPIO with the input buffer and the pull resistor disabled, which
+ * is the lowest leakage state of a pad that is not driven. A GPIO output keeps its level. The
+ * pins of the PORT instances held in reset and the locked pins are left as they are, the PORT
+ * clocks are restored after the pins are parked. Call it right before low power entry.
+ *
+ * @return Number of pins parked.
+ */
+uint32_t PinPark_Park(void);
+
+/*!
+ * @brief Restores the pins parked by PinPark_Park.
+ *
+ * Call it right after the wakeup, before the drivers use the pins.
+ */
+void PinPark_Restore(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_PIN_PARK_H_ */
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include "fsl_ram_footprint.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Symbols of the MCUXpresso managed linker script. */
+extern uint32_t __base_SRAM[];
+extern uint32_t __top_SRAM[];
+extern uint32_t __base_SRAMX[];
+extern uint32_t __top_SRAMX[];
+extern uint32_t _end_noinit[];
+extern uint32_t __end_noinit_RAM2[];
+extern uint32_t _pvHeapStart[];
+extern uint32_t _pvHeapLimit[];
+extern uint32_t _vStackBase[];
+extern uint32_t _vStackTop[];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+#if (defined(RAM_FOOTPRINT_PAINT_ENABLE) && (RAM_FOOTPRINT_PAINT_ENABLE > 0U))
+/* See fsl_ram_footprint.h for documentation of this function. */
+uint32_t RamFootprint_GetStackHighWaterMark(void)
+{
+    const uint32_t *word = _vStackBase;
+
+    /* The stack grows downwards, the lowest word not painted is the deepest one used. */
+    while ((word < _vStackTop) && (RAM_FOOTPRINT_PAINT_PATTERN == *word))
+    {
+        word++;
+    }
+
+    return (uint32_t)_vStackTop - (uint32_t)word;
+}
+
+/* See fsl_ram_footprint.h for documentation of this function. */
+uint32_t RamFootprint_GetHeapHighWaterMark(void)
+{
+    const uint32_t *word = _pvHeapLimit;
+
+    /* The heap grows upwards, the highest word not painted is the last one used. */
+    while ((word > _pvHeapStart) && (RAM_FOOTPRINT_PAINT_PATTERN == *(word - 1)))
+    {
+        word--;
+    }
+
+    return (uint32_t)word - (uint32_t)_pvHeapStart;
+}
+#endif /* RAM_FOOTPRINT_PAINT_ENABLE */
+
+/* See fsl_ram_footprint.h for documentation of this function. */
+void RamFootprint_Get(ram_footprint_t *footprint)
+{
+    assert(NULL != footprint);
+
+    footprint->sram.base        = (uint32_t)__base_SRAM;
+    footprint->sram.size        = (uint32_t)__top_SRAM - (uint32_t)__base_SRAM;
+    footprint->sram.staticSize  = (uint32_t)_end_noinit - (uint32_t)__base_SRAM;
+    footprint->sramx.base       = (uint32_t)__base_SRAMX;
+    footprint->sramx.size       = (uint32_t)__top_SRAMX - (uint32_t)__base_SRAMX;
+    footprint->sramx.staticSize = (uint32_t)__end_noinit_RAM2 - (uint32_t)__base_SRAMX;
+    footprint->heapBase         = (uint32_t)_pvHeapStart;
+    footprint->heapSize         = (uint32_t)_pvHeapLimit - (uint32_t)_pvHeapStart;
+    footprint->stackTop         = (uint32_t)_vStackTop;
+    footprint->stackSize        = (uint32_t)_vStackTop - (uint32_t)_vStackBase;
+#if (defined(RAM_FOOTPRINT_PAINT_ENABLE) && (RAM_FOOTPRINT_PAINT_ENABLE > 0U))
+    footprint->heapUsed  = RamFootprint_GetHeapHighWaterMark();
+    footprint->stackUsed = RamFootprint_GetStackHighWaterMark();
+#else
+    footprint->heapUsed  = 0U;
+    footprint->stackUsed = 0U;
+#endif /* RAM_FOOTPRINT_PAINT_ENABLE */
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_RAM_FOOTPRINT_H_
+#define _FSL_RAM_FOOTPRINT_H_
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup ram_footprint
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Enables the stack and heap painting.
+ *
+ * When enabled, the startup code fills the free stack and the heap with RAM_FOOTPRINT_PAINT_PATTERN,
+ * so the stack and heap high-water marks can be measured at runtime.
+ */
+#ifndef RAM_FOOTPRINT_PAINT_ENABLE
+#define RAM_FOOTPRINT_PAINT_ENABLE 0
+#endif /* RAM_FOOTPRINT_PAINT_ENABLE */
+
+/*! @brief Pattern painted to the stack and the heap. */
+#ifndef RAM_FOOTPRINT_PAINT_PATTERN
+#define RAM_FOOTPRINT_PAINT_PATTERN 0xA5A5A5A5U
+#endif /* RAM_FOOTPRINT_PAINT_PATTERN */
+
+/*! @brief Static footprint of a RAM region of the linker script. */
+typedef struct _ram_footprint_region
+{
+    uint32_t base;       /*!< Start address of the region. */
+    uint32_t size;       /*!< Size of the region in bytes. */
+    uint32_t staticSize; /*!< Bytes taken by the data, bss and noinit sections, from the start. */
+} ram_footprint_region_t;
+
+/*! @brief RAM footprint report. */
+typedef struct _ram_footprint
+{
+    ram_footprint_region_t sram;  /*!< SRAM region, RAMA banks. */
+    ram_footprint_region_t sramx; /*!< SRAMX region, RAMX0/X1 banks. */
+    uint32_t heapBase;            /*!< Start address of the heap, the heap grows upwards. */
+    uint32_t heapSize;            /*!< Size of the heap reserved by the linker script. */
+    uint32_t heapUsed;            /*!< Heap high-water mark in bytes, 0 if painting is disabled. */
+    uint32_t stackTop;            /*!< Initial stack pointer, the stack grows downwards. */
+    uint32_t stackSize;           /*!< Size of the stack reserved by the linker script. */
+    uint32_t stackUsed;           /*!< Stack high-water mark in bytes, 0 if painting is disabled. */
+} ram_footprint_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+#if (defined(RAM_FOOTPRINT_PAINT_ENABLE) && (RAM_FOOTPRINT_PAINT_ENABLE > 0U))
+/*!
+ * @brief Gets the stack high-water mark.
+ *
+ * @return Maximum number of stack bytes used since reset.
+ */
+uint32_t RamFootprint_GetStackHighWaterMark(void);
+
+/*!
+ * @brief Gets the heap high-water mark.
+ *
+ * @return Number of bytes from the heap start to the last heap byte used since reset.
+ */
+uint32_t RamFootprint_GetHeapHighWaterMark(void);
+#endif /* RAM_FOOTPRINT_PAINT_ENABLE */
+
+/*!
+ * @brief Gets the RAM footprint report.
+ *
+ * The static sizes come from the linker script symbols. The high-water marks are only measured
+ * when RAM_FOOTPRINT_PAINT_ENABLE is set. The banks above the static sections and the heap
+ * high-water mark, and below the stack high-water mark, are not used by the application.
+ *
+ * @param footprint Buffer to store the report.
+ */
+void RamFootprint_Get(ram_footprint_t *footprint);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_RAM_FOOTPRINT_H_ */
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_retained_data.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Marks a committed data block, "RETN". */
+#define RETAINED_DATA_MAGIC 0x5245544EU
+
+/*! @brief End of the reserved uninitialized section of SRAM, from the linker script. */
+extern uint32_t _end_uninit_RESERVED[];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t RetainedData_GetChecksum(const retained_data_header_t *header, const void *data, size_t size);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Fletcher-32 of the data, seeded with the magic word and the size of the header. */
+static uint32_t RetainedData_GetChecksum(const retained_data_header_t *header, const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t sum1        = (header->magic ^ header->size) & 0xFFFFU;
+    uint32_t sum2        = (header->magic >> 16U) & 0xFFFFU;
+    size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        sum1 += bytes[i];
+        if (sum1 >= 0xFFFFU)
+        {
+            sum1 -= 0xFFFFU;
+        }
+        sum2 += sum1;
+        if (sum2 >= 0xFFFFU)
+        {
+            sum2 -= 0xFFFFU;
+        }
+    }
+
+    return (sum2 << 16U) | sum1;
+}
+
+/* See fsl_retained_data.h for documentation of this function. */
+bool RetainedData_IsValid(const retained_data_header_t *header, const void *data, size_t size)
+{
+    assert((NULL != header) && (NULL != data));
+
+    return (RETAINED_DATA_MAGIC == header->magic) && (size == header->size) &&
+           (RetainedData_GetChecksum(header, data, size) == header->checksum);
+}
+
+/* See fsl_retained_data.h for documentation of this function. */
+void RetainedData_Commit(retained_data_header_t *header, const void *data, size_t size)
+{
+    assert((NULL != header) && (NULL != data));
+
+    header->magic    = RETAINED_DATA_MAGIC;
+    header->size     = (uint32_t)size;
+    header->checksum = RetainedData_GetChecksum(header, data, size);
+}
+
+/* See fsl_retained_data.h for documentation of this function. */
+void RetainedData_Invalidate(retained_data_header_t *header)
+{
+    assert(NULL != header);
+
+    header->magic = 0U;
+}
+
+/* See fsl_retained_data.h for documentation of this function. */
+bool RetainedData_IsInRama0(void)
+{
+    return ((uint32_t)_end_uninit_RESERVED <= (RETAINED_DATA_RAMA0_BASE + RETAINED_DATA_RAMA0_SIZE));
+}
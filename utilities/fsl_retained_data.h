@@ -0,0 +1,119 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_RETAINED_DATA_H_
+#define _FSL_RETAINED_DATA_H_
+
+#include "fsl_common.h"
+#include <cr_section_macros.h>
+
+/*!
+ * @addtogroup retained_data
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Places a variable in RAMX0/X1.
+ *
+ * The variable goes to the noinit section of SRAMX in the linker script managed by the IDE, which
+ * the startup code does not initialize. It keeps its content across warm resets, and across PowerDown
+ * and DeepPowerDown when RAMX0/X1 is retained.
+ */
+#define RETAINED_DATA_RAMX __NOINIT(RAM2)
+
+/*!
+ * @brief Places a variable in RAMA0.
+ *
+ * Same as RETAINED_DATA_RAMX, for the RAMA0 retention setting. The variable goes to the reserved
+ * uninitialized section, the first one of SRAM, so it is in RAMA0 as long as that section is smaller
+ * than RAMA0, check it with @ref RetainedData_IsInRama0 at startup. RAMA0 supports ECC, when the ECC is
+ * enabled the first read after a power loss may report an ECC error, since the content was never written.
+ */
+#define RETAINED_DATA_RAMA0 __BSS(RESERVED)
+
+/*! @brief Start address of RAMA0, the first bank of SRAM. */
+#define RETAINED_DATA_RAMA0_BASE 0x20000000U
+
+/*! @brief Size of RAMA0 in bytes. */
+#define RETAINED_DATA_RAMA0_SIZE 0x2000U
+
+/*!
+ * @brief Header of a retained data block.
+ *
+ * Place the header next to the data it protects, both in a retained section. The content of a RAM
+ * that was not retained is random, the header tells whether the data are still valid.
+ */
+typedef struct _retained_data_header
+{
+    uint32_t magic;    /*!< Magic word, set when the data are committed. */
+    uint32_t size;     /*!< Size of the data in bytes when committed. */
+    uint32_t checksum; /*!< Checksum of the data and of the fields above. */
+} retained_data_header_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Checks whether retained data survived the last reset or low power mode.
+ *
+ * Call this function after reset, before using the data. If it returns false, the data must be
+ * initialized by the application and committed with @ref RetainedData_Commit.
+ *
+ * @param header Header of the data block.
+ * @param data Start address of the data.
+ * @param size Size of the data in bytes.
+ * @retval true  The data are the ones last committed.
+ * @retval false The data were lost, or were never committed.
+ */
+bool RetainedData_IsValid(const retained_data_header_t *header, const void *data, size_t size);
+
+/*!
+ * @brief Commits retained data.
+ *
+ * Call this function after changing the data, at the latest before entering the low power mode
+ * or resetting.
+ *
+ * @param header Header of the data block.
+ * @param data Start address of the data.
+ * @param size Size of the data in bytes.
+ */
+void RetainedData_Commit(retained_data_header_t *header, const void *data, size_t size);
+
+/*!
+ * @brief Checks that the RETAINED_DATA_RAMA0 variables are in RAMA0.
+ *
+ * The linker script is managed by the IDE and cannot bound the reserved section to RAMA0, call this
+ * function at startup, for example in an assert.
+ *
+ * @retval true  The reserved section ends within RAMA0.
+ * @retval false The reserved section is larger than RAMA0, part of it is not retained.
+ */
+bool RetainedData_IsInRama0(void);
+
+/*!
+ * @brief Invalidates retained data.
+ *
+ * @param header Header of the data block.
+ */
+void RetainedData_Invalidate(retained_data_header_t *header);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_RETAINED_DATA_H_ */
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_retained_trace.h"
+#include <cr_section_macros.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Marks a valid trace ring, "TRAC". */
+#define RETAINED_TRACE_MAGIC 0x54524143U
+
+/*! @brief Trace ring, kept in RAM that is not initialized by the startup code. */
+typedef struct _retained_trace_ring
+{
+    uint32_t magic;    /*!< RETAINED_TRACE_MAGIC if the ring is valid. */
+    uint32_t head;     /*!< Index of the next record to write. */
+    uint32_t count;    /*!< Number of records in the ring. */
+    uint32_t sequence; /*!< Sequence number of the next record. */
+    uint32_t check;    /*!< Check word of the fields above. */
+    retained_trace_record_t records[RETAINED_TRACE_RECORD_COUNT]; /*!< Records. */
+} retained_trace_ring_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t RetainedTrace_GetRingCheck(void);
+static uint8_t RetainedTrace_GetRecordCheck(const retained_trace_record_t *record);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static retained_trace_ring_t s_retainedTrace RETAINED_TRACE_PLACEMENT;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t RetainedTrace_GetRingCheck(void)
+{
+    return ~(s_retainedTrace.magic ^ s_retainedTrace.head ^ (s_retainedTrace.count << 8U) ^
+             (s_retainedTrace.sequence << 16U));
+}
+
+static uint8_t RetainedTrace_GetRecordCheck(const retained_trace_record_t *record)
+{
+    uint32_t check = record->value ^ ((uint32_t)record->event << 8U) ^ record->sequence;
+
+    check ^= check >> 16U;
+    check ^= check >> 8U;
+
+    return (uint8_t)(check ^ 0x5AU);
+}
+
+/* See fsl_retained_trace.h for documentation of this function. */
+uint32_t RetainedTrace_Init(void)
+{
+    bool valid;
+    uint32_t index;
+    uint32_t i;
+
+    /* Content of a RAM that was not retained is random, check every field before using it. */
+    valid = (RETAINED_TRACE_MAGIC == s_retainedTrace.magic) &&
+            (RetainedTrace_GetRingCheck() == s_retainedTrace.check) &&
+            (s_retainedTrace.head < RETAINED_TRACE_RECORD_COUNT) &&
+            (s_retainedTrace.count <= RETAINED_TRACE_RECORD_COUNT);
+
+    index = s_retainedTrace.head + RETAINED_TRACE_RECORD_COUNT - s_retainedTrace.count;
+    for (i = 0U; valid && (i < s_retainedTrace.count); i++)
+    {
+        if (index >= RETAINED_TRACE_RECORD_COUNT)
+        {
+            index -= RETAINED_TRACE_RECORD_COUNT;
+        }
+        valid = (s_retainedTrace.records[index].check == RetainedTrace_GetRecordCheck(&s_retainedTrace.records[index]));
+        index++;
+    }
+
+    if (!valid)
+    {
+        s_retainedTrace.magic    = RETAINED_TRACE_MAGIC;
+        s_retainedTrace.head     = 0U;
+        s_retainedTrace.count    = 0U;
+        s_retainedTrace.sequence = 0U;
+        s_retainedTrace.check    = RetainedTrace_GetRingCheck();
+    }
+
+    return s_retainedTrace.count;
+}
+
+/* See fsl_retained_trace.h for documentation of this function. */
+void RetainedTrace_Record(uint16_t event, uint32_t value)
+{
+    retained_trace_record_t *record;
+    uint32_t irqMask;
+
+    irqMask = DisableGlobalIRQ();
+
+    record           = &s_retainedTrace.records[s_retainedTrace.head];
+    record->event    = event;
+    record->sequence = (uint8_t)s_retainedTrace.sequence;
+    record->value    = value;
+    record->check    = RetainedTrace_GetRecordCheck(record);
+
+    s_retainedTrace.head++;
+    if (RETAINED_TRACE_RECORD_COUNT == s_retainedTrace.head)
+    {
+        s_retainedTrace.head = 0U;
+    }
+    if (s_retainedTrace.count < RETAINED_TRACE_RECORD_COUNT)
+    {
+        s_retainedTrace.count++;
+    }
+    s_retainedTrace.sequence++;
+    s_retainedTrace.check = RetainedTrace_GetRingCheck();
+
+    EnableGlobalIRQ(irqMask);
+}
+
+/* See fsl_retained_trace.h for documentation of this function. */
+bool RetainedTrace_Pop(retained_trace_record_t *record)
+{
+    uint32_t irqMask;
+    uint32_t index;
+    bool popped = false;
+
+    assert(NULL != record);
+
+    irqMask = DisableGlobalIRQ();
+
+    if (0U != s_retainedTrace.count)
+    {
+        index = s_retainedTrace.head + RETAINED_TRACE_RECORD_COUNT - s_retainedTrace.count;
+        if (index >= RETAINED_TRACE_RECORD_COUNT)
+        {
+            index -= RETAINED_TRACE_RECORD_COUNT;
+        }
+        *record = s_retainedTrace.records[index];
+
+        s_retainedTrace.count--;
+        s_retainedTrace.check = RetainedTrace_GetRingCheck();
+        popped                = true;
+    }
+
+    EnableGlobalIRQ(irqMask);
+
+    return popped;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_RETAINED_TRACE_H_
+#define _FSL_RETAINED_TRACE_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup retained_trace
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Number of records kept in the trace ring, the oldest record is overwritten when the ring is full. */
+#ifndef RETAINED_TRACE_RECORD_COUNT
+#define RETAINED_TRACE_RECORD_COUNT 64U
+#endif /* RETAINED_TRACE_RECORD_COUNT */
+
+/*! @brief Placement of the trace ring, an attribute from cr_section_macros.h.
+ *
+ *  The default is the SRAMX (RAM2) NOLOAD section of the MCUXpresso managed linker script, it is not
+ *  initialized by the startup code, so the ring survives warm resets, and PowerDown/DeepPowerDown
+ *  when RAMX0/X1 is retained.
+ */
+#ifndef RETAINED_TRACE_PLACEMENT
+#define RETAINED_TRACE_PLACEMENT __NOINIT(RAM2)
+#endif /* RETAINED_TRACE_PLACEMENT */
+
+/*! @brief Trace record. */
+typedef struct _retained_trace_record
+{
+    uint16_t event;   /*!< Event ID, defined by the application. */
+    uint8_t sequence; /*!< Sequence number, increased for every record. */
+    uint8_t check;    /*!< Check byte of the record. */
+    uint32_t value;   /*!< Event argument. */
+} retained_trace_record_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initializes the trace ring.
+ *
+ * Call this function once after reset, before any other function of this module. The records
+ * left by the previous run are kept if the ring is valid, otherwise the ring is cleared.
+ *
+ * @return Number of records left by the previous run.
+ */
+uint32_t RetainedTrace_Init(void);
+
+/*!
+ * @brief Adds a record to the trace ring.
+ *
+ * The record is written to RAM directly, so this function is short and can be called in
+ * interrupt handlers, fault handlers and right before low power entry.
+ *
+ * @param event Event ID.
+ * @param value Event argument.
+ */
+void RetainedTrace_Record(uint16_t event, uint32_t value);
+
+/*!
+ * @brief Gets and removes the oldest record of the trace ring.
+ *
+ * @param record Buffer to store the record.
+ * @retval true  A record is returned.
+ * @retval false The ring is empty.
+ */
+bool RetainedTrace_Pop(retained_trace_record_t *record);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_RETAINED_TRACE_H_ */
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_spsc_queue.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/*!
+ * @brief Copies words between the ring storage and a linear buffer.
+ *
+ * @param queue Queue state.
+ * @param index Free running index of the first word in the ring.
+ * @param data Linear buffer.
+ * @param count Number of words.
+ * @param toRing true to copy to the ring, false to copy from it.
+ */
+static void SpscQueue_Copy(spsc_queue_t *queue, uint32_t index, uint32_t *data, uint32_t count, bool toRing);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void SpscQueue_Copy(spsc_queue_t *queue, uint32_t index, uint32_t *data, uint32_t count, bool toRing)
+{
+    uint32_t offset = index & queue->mask;
+    uint32_t first  = MIN(count, queue->mask + 1U - offset);
+
+    if (toRing)
+    {
+        (void)memcpy(&queue->buffer[offset], data, first * sizeof(uint32_t));
+        (void)memcpy(&queue->buffer[0], &data[first], (count - first) * sizeof(uint32_t));
+    }
+    else
+    {
+        (void)memcpy(data, &queue->buffer[offset], first * sizeof(uint32_t));
+        (void)memcpy(&data[first], &queue->buffer[0], (count - first) * sizeof(uint32_t));
+    }
+}
+
+/* See fsl_spsc_queue.h for documentation of this function. */
+status_t SpscQueue_Init(spsc_queue_t *queue, uint32_t *buffer, uint32_t capacity)
+{
+    assert((NULL != queue) && (NULL != buffer));
+
+    if ((0U == capacity) || (0U != (capacity & (capacity - 1U))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    queue->buffer = buffer;
+    queue->mask   = capacity - 1U;
+    queue->head   = 0U;
+    queue->tail   = 0U;
+
+    return kStatus_Success;
+}
+
+/* See fsl_spsc_queue.h for documentation of this function. */
+uint32_t SpscQueue_Push(spsc_queue_t *queue, const uint32_t *data, uint32_t count)
+{
+    uint32_t head = queue->head;
+    uint32_t tail = queue->tail;
+
+    /* The words popped by the consumer must be read before they are overwritten. */
+    __DMB();
+
+    count = MIN(count, queue->mask + 1U - (head - tail));
+    if (0U != count)
+    {
+        SpscQueue_Copy(queue, head, (uint32_t *)(uintptr_t)data, count, true);
+
+        /* Publish the words after they are written. */
+        __DMB();
+        queue->head = head + count;
+    }
+
+    return count;
+}
+
+/* See fsl_spsc_queue.h for documentation of this function. */
+uint32_t SpscQueue_Pop(spsc_queue_t *queue, uint32_t *data, uint32_t count)
+{
+    uint32_t tail = queue->tail;
+    uint32_t head = queue->head;
+
+    /* The words must be read after the index that published them. */
+    __DMB();
+
+    count = MIN(count, head - tail);
+    if (0U != count)
+    {
+        SpscQueue_Copy(queue, tail, data, count, false);
+
+        /* Release the slots after the words are read. */
+        __DMB();
+        queue->tail = tail + count;
+    }
+
+    return count;
+}
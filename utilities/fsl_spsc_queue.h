@@ -0,0 +1,99 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_SPSC_QUEUE_H_
+#define _FSL_SPSC_QUEUE_H_
+
+#include "fsl_common.h"
+
+/*!
+ * @addtogroup spsc_queue
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Single producer, single consumer queue of 32-bit words.
+ *
+ * One context pushes and one context pops, for example an interrupt handler and the main loop.
+ * Each side only writes its own index, the indexes are free running and wrap around, so the
+ * queue needs no lock and no interrupt masking.
+ */
+typedef struct _spsc_queue
+{
+    uint32_t *buffer;       /*!< Storage of the words. */
+    uint32_t mask;          /*!< Capacity minus one, the capacity is a power of two. */
+    volatile uint32_t head; /*!< Number of words pushed, written by the producer only. */
+    volatile uint32_t tail; /*!< Number of words popped, written by the consumer only. */
+} spsc_queue_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initializes a queue.
+ *
+ * Call it before the producer and the consumer use the queue.
+ *
+ * @param queue Queue state.
+ * @param buffer Storage of the words.
+ * @param capacity Number of words of the storage, a power of two.
+ * @retval kStatus_Success The queue is initialized.
+ * @retval kStatus_InvalidArgument The capacity is not a power of two.
+ */
+status_t SpscQueue_Init(spsc_queue_t *queue, uint32_t *buffer, uint32_t capacity);
+
+/*!
+ * @brief Pushes words to the queue, producer side.
+ *
+ * The words are pushed as one block, the consumer sees all of them or none of them.
+ *
+ * @param queue Queue state.
+ * @param data Words to push.
+ * @param count Number of words to push.
+ * @return Number of words pushed, less than count if the queue is full.
+ */
+uint32_t SpscQueue_Push(spsc_queue_t *queue, const uint32_t *data, uint32_t count);
+
+/*!
+ * @brief Pops words from the queue, consumer side.
+ *
+ * @param queue Queue state.
+ * @param data Buffer to store the words.
+ * @param count Maximum number of words to pop.
+ * @return Number of words popped, 0 if the queue is empty.
+ */
+uint32_t SpscQueue_Pop(spsc_queue_t *queue, uint32_t *data, uint32_t count);
+
+/*!
+ * @brief Gets the number of words in the queue.
+ *
+ * The result is exact for the consumer, the producer may push more words meanwhile.
+ *
+ * @param queue Queue state.
+ * @return Number of words in the queue.
+ */
+static inline uint32_t SpscQueue_GetCount(const spsc_queue_t *queue)
+{
+    return queue->head - queue->tail;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_SPSC_QUEUE_H_ */
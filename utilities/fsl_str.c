@@ -38,6 +38,84 @@
 #define STR_FORMAT_PRINTF_UVAL_TYPE unsigned int
 #define STR_FORMAT_PRINTF_IVAL_TYPE int
 #endif
+
+/*! @brief Printf conversion classes, looked up from the specifier character. */
+enum _str_printf_conv
+{
+    kPRINTF_ConvNone = 0U, /*!< Not a conversion, the character is printed as is. */
+    kPRINTF_ConvSigned,    /*!< d, i */
+    kPRINTF_ConvUnsigned,  /*!< o, b, p, u */
+    kPRINTF_ConvHex,       /*!< x, X */
+    kPRINTF_ConvFloat,     /*!< f, F */
+    kPRINTF_ConvChar,      /*!< c */
+    kPRINTF_ConvString,    /*!< s */
+};
+
+/*! @brief First and last characters covered by the conversion table. */
+#define PRINTF_CONV_TABLE_FIRST 'F'
+#define PRINTF_CONV_TABLE_LAST  'x'
+
+/*! @brief Output buffer of StrFormatVsnprintf. */
+typedef struct _str_bounded_buffer
+{
+    char *data;  /*!< Buffer to store the output. */
+    size_t size; /*!< Size of the buffer, including the terminating '\0'. */
+} str_bounded_buffer_t;
+
+#if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U)) && \
+    (defined(PRINTF_FLOAT_FIXED_POINT_ENABLE) && (PRINTF_FLOAT_FIXED_POINT_ENABLE > 0U))
+#if (defined(PRINTF_FLOAT_EXACT_ENABLE) && (PRINTF_FLOAT_EXACT_ENABLE > 0U))
+/*! @brief Words of the fixed-point float conversion, enough for the 1074 fraction bits of the
+ * smallest subnormal and for the 1024 bits of the largest integer part. */
+#define PRINTF_FLOAT_WORDS 34U
+
+/*! @brief Base 10^9 chunks of the largest integer part, DBL_MAX has 309 digits. */
+#define PRINTF_FLOAT_CHUNKS 35U
+#else
+/*! @brief Words of the fixed-point float conversion, the fraction bits below 2^-96 are dropped. */
+#define PRINTF_FLOAT_WORDS 3U
+
+/*! @brief Base 10^9 chunks of the leading digits of the integer part, which has at most 64 bits. */
+#define PRINTF_FLOAT_CHUNKS 3U
+#endif /* PRINTF_FLOAT_EXACT_ENABLE */
+
+/*! @brief Base of the integer part chunks. */
+#define PRINTF_FLOAT_CHUNK_BASE 1000000000U
+
+/*! @brief Fraction digits kept from the rounding pass, larger precisions generate the digits twice. */
+#define PRINTF_FLOAT_DIGIT_CACHE 20U
+
+/*! @brief Binary fraction of the fixed-point float conversion, the binary point is above the top word. */
+typedef struct _str_float_fract
+{
+    uint32_t word[PRINTF_FLOAT_WORDS]; /*!< Fraction bits, least significant word first. */
+    uint32_t low;                      /*!< Words below this index are zero. */
+    uint32_t words;                    /*!< Number of words of the fraction. */
+} str_float_fract_t;
+#endif /* PRINTF_FLOAT_FIXED_POINT_ENABLE */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/*! @brief Conversion class and radix of each printf specifier, indexed from PRINTF_CONV_TABLE_FIRST. */
+static const uint8_t s_printfConvTable[(uint8_t)PRINTF_CONV_TABLE_LAST - (uint8_t)PRINTF_CONV_TABLE_FIRST + 1U][2] = {
+    ['F' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvFloat, 10U},
+    ['X' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvHex, 16U},
+    ['b' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvUnsigned, 2U},
+    ['c' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvChar, 0U},
+    ['d' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvSigned, 10U},
+    ['f' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvFloat, 10U},
+    ['i' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvSigned, 10U},
+    ['o' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvUnsigned, 8U},
+    ['p' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvUnsigned, 16U},
+    ['s' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvString, 0U},
+    ['u' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvUnsigned, 10U},
+    ['x' - PRINTF_CONV_TABLE_FIRST] = {(uint8_t)kPRINTF_ConvHex, 16U},
+};
+
+/*! @brief Digit characters of integer conversions, lower case then upper case. */
+static const char s_printfDigits[] = "0123456789abcdef0123456789ABCDEF";
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -49,6 +127,16 @@
  */
 static uint32_t ScanIgnoreWhiteSpace(const char **s);
 
+/*!
+ * @brief Puts the characters produced by StrFormatPrintf to a buffer of limited size.
+ *
+ * @param[in] buf        Pointer to the str_bounded_buffer_t of the output.
+ * @param[in] indicator  Number of characters printed so far.
+ * @param[in] dbgVal     Character to put.
+ * @param[in] len        Number of times the character is put.
+ */
+static void StrFormatBoundedCallback(char *buf, int32_t *indicator, char dbgVal, int len);
+
 /*!
  * @brief Converts a radix number to a string and return its length.
  *
@@ -62,7 +150,8 @@ static uint32_t ScanIgnoreWhiteSpace(const char **s);
  */
 static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps);
 
-#if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
+#if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U)) && \
+    !(defined(PRINTF_FLOAT_FIXED_POINT_ENABLE) && (PRINTF_FLOAT_FIXED_POINT_ENABLE > 0U))
 /*!
  * @brief Converts a floating radix number to a string and return its length.
  *
@@ -192,24 +281,24 @@ static uint32_t PrintGetPrecision(const char **s, va_list *ap, bool *valid_preci
     return precision_width;
 }
 
-static uint32_t PrintIsobpu(const char c)
+/*!
+ * @brief Looks up the conversion class and radix of a printf specifier.
+ *
+ * @param[in]  c      The specifier character.
+ * @param[out] radix  The radix of integer conversions.
+ *
+ * @return Conversion class, kPRINTF_ConvNone if c is not a known specifier.
+ */
+static uint8_t PrintGetConversion(const char c, unsigned int *radix)
 {
-    uint32_t ret = 0U;
-    if ((c == 'o') || (c == 'b') || (c == 'p') || (c == 'u'))
-    {
-        ret = 1U;
-    }
-    return ret;
-}
+    uint8_t conv = (uint8_t)kPRINTF_ConvNone;
 
-static uint32_t PrintIsdi(const char c)
-{
-    uint32_t ret = 0U;
-    if ((c == 'd') || (c == 'i'))
+    if ((c >= PRINTF_CONV_TABLE_FIRST) && (c <= PRINTF_CONV_TABLE_LAST))
     {
-        ret = 1U;
+        conv   = s_printfConvTable[(uint8_t)c - (uint8_t)PRINTF_CONV_TABLE_FIRST][0];
+        *radix = (unsigned int)s_printfConvTable[(uint8_t)c - (uint8_t)PRINTF_CONV_TABLE_FIRST][1];
     }
-    return ret;
+    return conv;
 }
 
 static void PrintOutputdifFobpu(uint32_t flags_used,
@@ -222,8 +311,8 @@ static void PrintOutputdifFobpu(uint32_t flags_used,
                                 int32_t *count)
 {
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    /* Do the ZERO pad. */
-    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
+    /* Do the ZERO pad, left justification takes precedence. */
+    if ((uint32_t)kPRINTF_Zero == (flags_used & ((uint32_t)kPRINTF_Zero | (uint32_t)kPRINTF_Minus)))
     {
         if ('\0' != schar)
         {
@@ -276,13 +365,16 @@ static void PrintOutputxX(uint32_t flags_used,
 {
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
     uint8_t dschar = 0;
-    if (0U != (flags_used & (uint32_t)kPRINTF_Zero))
+    /* Do the ZERO pad, left justification takes precedence. */
+    if ((uint32_t)kPRINTF_Zero == (flags_used & ((uint32_t)kPRINTF_Zero | (uint32_t)kPRINTF_Minus)))
     {
         if (0U != (flags_used & (uint32_t)kPRINTF_Pound))
         {
             cb(buf, count, '0', 1);
             cb(buf, count, (use_caps ? 'X' : 'x'), 1);
             dschar = 1U;
+            /* The prefix is part of the field width. */
+            vlen += 2U;
         }
         cb(buf, count, '0', (int)field_width - (int)vlen);
         vlen = field_width;
@@ -326,26 +418,6 @@ static void PrintOutputxX(uint32_t flags_used,
 #endif /* PRINTF_ADVANCED_ENABLE */
 }
 
-static uint32_t PrintIsfF(const char c)
-{
-    uint32_t ret = 0U;
-    if ((c == 'f') || (c == 'F'))
-    {
-        ret = 1U;
-    }
-    return ret;
-}
-
-static uint32_t PrintIsxX(const char c)
-{
-    uint32_t ret = 0U;
-    if ((c == 'x') || (c == 'X'))
-    {
-        ret = 1U;
-    }
-    return ret;
-}
-
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
 static uint32_t PrintCheckFlags(const char **s)
 {
@@ -459,29 +531,6 @@ static void PrintFilterLengthFlag(const char **s)
 }
 #endif /* PRINTF_ADVANCED_ENABLE */
 
-static uint8_t PrintGetRadixFromobpu(const char c)
-{
-    uint8_t radix;
-
-    if (c == 'o')
-    {
-        radix = 8U;
-    }
-    else if (c == 'b')
-    {
-        radix = 2U;
-    }
-    else if (c == 'p')
-    {
-        radix = 16U;
-    }
-    else
-    {
-        radix = 10U;
-    }
-    return radix;
-}
-
 static uint32_t ScanIsWhiteSpace(const char c)
 {
     uint32_t ret = 0U;
@@ -509,152 +558,496 @@ static uint32_t ScanIgnoreWhiteSpace(const char **s)
 
 static int32_t ConvertRadixNumToString(char *numstr, void *nump, unsigned int neg, unsigned int radix, bool use_caps)
 {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    long long int a;
-    long long int b;
-    long long int c;
-
-    unsigned long long int ua;
-    unsigned long long int ub;
-    unsigned long long int uc;
-    unsigned long long int uc_param;
-#else
-    int a;
-    int b;
-    int c;
-
-    unsigned int ua;
-    unsigned int ub;
-    unsigned int uc;
-    unsigned int uc_param;
-#endif /* PRINTF_ADVANCED_ENABLE */
-
+    STR_FORMAT_PRINTF_UVAL_TYPE ua;
+    uint32_t ua32;
+    uint32_t shift;
+    const char *digits;
     int32_t nlen;
     char *nstrp;
 
     nlen     = 0;
     nstrp    = numstr;
     *nstrp++ = '\0';
+    digits   = use_caps ? &s_printfDigits[16] : &s_printfDigits[0];
 
-#if !(defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0u))
-    neg = 0U;
-#endif
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+    if (0U != neg)
+    {
+        long long int a = *(long long int *)nump;
+        /* Convert the magnitude, the sign is printed by the caller. */
+        ua = (a < 0) ? (0ULL - (unsigned long long int)a) : (unsigned long long int)a;
+    }
+    else
+#endif /* PRINTF_ADVANCED_ENABLE */
+    {
+        ua = *(STR_FORMAT_PRINTF_UVAL_TYPE *)nump;
+    }
+    (void)neg;
 
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0ULL;
-    ub       = 0ULL;
-    uc       = 0ULL;
-    uc_param = 0ULL;
-#else
-    a        = 0;
-    b        = 0;
-    c        = 0;
-    ua       = 0U;
-    ub       = 0U;
-    uc       = 0U;
-    uc_param = 0U;
+    /* Use the 64-bit division only for the digits above 32 bits. */
+    while (ua > 0xFFFFFFFFULL)
+    {
+        *nstrp++ = digits[ua % radix];
+        ua /= radix;
+        ++nlen;
+    }
 #endif /* PRINTF_ADVANCED_ENABLE */
 
-    (void)a;
-    (void)b;
-    (void)c;
-    (void)ua;
-    (void)ub;
-    (void)uc;
-    (void)uc_param;
-    (void)neg;
+    ua32 = (uint32_t)ua;
+    if (10U == radix)
+    {
+        /* Constant divisor, the compiler turns it into a multiply. */
+        do
+        {
+            *nstrp++ = digits[ua32 % 10U];
+            ua32 /= 10U;
+            ++nlen;
+        } while (0U != ua32);
+    }
+    else
+    {
+        /* Other radixes are powers of two. */
+        shift = (16U == radix) ? 4U : ((8U == radix) ? 3U : 1U);
+        do
+        {
+            *nstrp++ = digits[ua32 & (radix - 1U)];
+            ua32 >>= shift;
+            ++nlen;
+        } while (0U != ua32);
+    }
+    return nlen;
+}
+
+#if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
+#if (defined(PRINTF_FLOAT_FIXED_POINT_ENABLE) && (PRINTF_FLOAT_FIXED_POINT_ENABLE > 0U))
+static void ConvertFloatLoadFraction(str_float_fract_t *fract, uint64_t mant, uint32_t shift)
+{
+    uint64_t f;
+    uint32_t b0;
+    uint32_t part[3];
+    uint32_t i;
+
+    /* The fraction is mant / 2^shift, moved so that the binary point is on a word boundary. */
+    f = (shift < 64U) ? (mant & ((1ULL << shift) - 1ULL)) : mant;
+    if (shift > (PRINTF_FLOAT_WORDS * 32U))
+    {
+        /* Only with the bounded conversion: keep the bits which fit, the dropped ones are below 2^-96. */
+        b0    = shift - (PRINTF_FLOAT_WORDS * 32U);
+        f     = (b0 < 64U) ? (f >> b0) : 0ULL;
+        shift = PRINTF_FLOAT_WORDS * 32U;
+    }
+    fract->words = (shift + 31U) / 32U;
+    fract->low   = 0U;
+    b0           = (fract->words * 32U) - shift;
+    part[0]      = (uint32_t)(f << b0);
+    part[1]      = (uint32_t)((f << b0) >> 32U);
+    part[2]      = (0U == b0) ? 0U : (uint32_t)(f >> (64U - b0));
+    for (i = 0U; i < fract->words; i++)
+    {
+        fract->word[i] = (i < 3U) ? part[i] : 0U;
+    }
+}
+
+static uint32_t ConvertFloatNextDigit(str_float_fract_t *fract)
+{
+    uint64_t t = 0ULL;
+    uint32_t i;
+
+    /* Multiply by ten, the digit is what is carried out of the top word. */
+    while ((fract->low < fract->words) && (0U == fract->word[fract->low]))
+    {
+        fract->low++;
+    }
+    for (i = fract->low; i < fract->words; i++)
+    {
+        t              = ((uint64_t)fract->word[i] * 10U) + (t >> 32U);
+        fract->word[i] = (uint32_t)t;
+    }
+    return (uint32_t)(t >> 32U);
+}
+
+static int32_t ConvertFloatCompareHalf(const str_float_fract_t *fract)
+{
+    uint32_t top = fract->word[fract->words - 1U];
+    uint32_t i;
+    int32_t ret;
+
+    if (0U == (top & 0x80000000U))
+    {
+        ret = -1;
+    }
+    else
+    {
+        ret = (0U != (top & 0x7FFFFFFFU)) ? 1 : 0;
+        for (i = fract->low; (0 == ret) && ((i + 1U) < fract->words); i++)
+        {
+            if (0U != fract->word[i])
+            {
+                ret = 1;
+            }
+        }
+    }
+    return ret;
+}
+
+#if !(defined(PRINTF_FLOAT_EXACT_ENABLE) && (PRINTF_FLOAT_EXACT_ENABLE > 0U))
+static uint32_t ConvertFloatScaleInteger(uint64_t *value, uint32_t e2)
+{
+    uint64_t m     = *value;
+    uint64_t mid;
+    uint64_t q;
+    uint32_t zeros = 0U;
+    uint32_t hi;
+    uint32_t lo;
+    uint32_t rem;
+
     /*
-     * Fix MISRA issue: CID 15972928 (#15 of 15): MISRA C-2012 Control Flow Expressions (MISRA C-2012 Rule 14.3)
-     * misra_c_2012_rule_14_3_violation: Execution cannot reach this statement: a = *((int *)nump);
+     * value * 2^e2 does not fit in 64 bits. The factors of two are shifted in while they fit, each
+     * other one is traded for a factor of ten taken out as a trailing zero and a division by five,
+     * rounded, which keeps at least 60 significant bits. DBL_MAX takes 290 divisions, the relative
+     * error stays below 2^-52.
      */
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    if (0U != neg)
+    while (e2 > 0U)
     {
+        hi = (uint32_t)(m >> 32U);
+        lo = (uint32_t)m;
+        if (0U == (hi & 0x80000000U))
+        {
+            rem = (0U != hi) ? (uint32_t)__CLZ(hi) : (32U + (uint32_t)__CLZ(lo));
+            rem = MIN(rem, e2);
+            m <<= rem;
+            e2 -= rem;
+        }
+        else
+        {
+            /* Divide by five as the high half of m * 0xCCCCCCCCCCCCCCCD, shifted right by two. */
+            mid = ((((uint64_t)lo * 0xCCCCCCCDU) >> 32U) + (uint32_t)((uint64_t)lo * 0xCCCCCCCCU)) +
+                  (uint32_t)((uint64_t)hi * 0xCCCCCCCDU);
+            q = ((uint64_t)hi * 0xCCCCCCCCU) + (((uint64_t)lo * 0xCCCCCCCCU) >> 32U) +
+                (((uint64_t)hi * 0xCCCCCCCDU) >> 32U) + (mid >> 32U);
+            q >>= 2U;
+            rem = lo - ((uint32_t)q * 5U);
+            m   = (rem >= 3U) ? (q + 1ULL) : q;
+            zeros++;
+            e2--;
+        }
+    }
+    *value = m;
+    return zeros;
+}
+#endif /* PRINTF_FLOAT_EXACT_ENABLE */
+
+static uint32_t ConvertFloatIntegerChunks(uint32_t *chunk, uint32_t *word, uint32_t words)
+{
+    uint64_t t;
+    uint32_t rem;
+    uint32_t i;
+    uint32_t n = 0U;
+
+    /* Divide by 10^9 until the integer is gone, the 32-bit case avoids the 64-bit division. */
+    while ((words > 1U) && (0U == word[words - 1U]))
+    {
+        words--;
+    }
+    do
+    {
+        if (1U == words)
+        {
+            chunk[n++] = word[0] % PRINTF_FLOAT_CHUNK_BASE;
+            word[0] /= PRINTF_FLOAT_CHUNK_BASE;
+        }
+        else
+        {
+            rem = 0U;
+            for (i = words; i > 0U; i--)
+            {
+                t            = ((uint64_t)rem << 32U) | word[i - 1U];
+                word[i - 1U] = (uint32_t)(t / PRINTF_FLOAT_CHUNK_BASE);
+                rem          = (uint32_t)(t % PRINTF_FLOAT_CHUNK_BASE);
+            }
+            chunk[n++] = rem;
+        }
+        while ((words > 1U) && (0U == word[words - 1U]))
+        {
+            words--;
+        }
+    } while ((words > 1U) || (0U != word[0]));
+    return n;
+}
+
+static void PrintOutputFloatChunk(uint32_t chunk, uint32_t digits, printfCb cb, char *buf, int32_t *count)
+{
+    char vstr[9];
+    uint32_t i;
+
+    for (i = digits; i > 0U; i--)
+    {
+        vstr[i - 1U] = (char)('0' + (chunk % 10U));
+        chunk /= 10U;
+    }
+    for (i = 0U; i < digits; i++)
+    {
+        cb(buf, count, vstr[i], 1);
+    }
+}
+
+/*!
+ * @brief Prints a double in %f format with integer operations only.
+ *
+ * The value is decoded from its bit pattern, digits are streamed to the callback and the last digit
+ * is rounded half to even. With PRINTF_FLOAT_EXACT_ENABLE the conversion is exact for any precision
+ * and magnitude, like the C library. Otherwise it is exact below 2^64 down to 2^-96, larger integer
+ * parts keep their 20 leading digits with a relative error below 2^-52, and fraction bits below 2^-96
+ * are dropped.
+ */
+static void PrintOutputFloat(uint32_t flags_used,
+                             uint32_t field_width,
+                             uint32_t precision_width,
+                             bool use_caps,
+                             double fval,
+                             printfCb cb,
+                             char *buf,
+                             int32_t *count)
+{
+    str_float_fract_t fract;
+    uint32_t chunk[PRINTF_FLOAT_CHUNKS];
+    char digits[PRINTF_FLOAT_DIGIT_CACHE];
+    uint32_t intword[2];
+    uint64_t bits;
+    uint64_t mant;
+    uint64_t intpart;
+    uint32_t expo;
+    uint32_t shift  = 0U;
+    uint32_t nines  = 0U;
+    uint32_t ndigit = 0U;
+    uint32_t digit  = 0U;
+    uint32_t zeros  = 0U;
+    uint32_t nchunk;
+    uint32_t top;
+    uint32_t stop;
+    uint32_t vlen;
+    uint32_t i;
+    int32_t e2;
+    int32_t half;
+    bool round_up = false;
+    bool left     = false;
+    bool zero     = false;
+    bool pound    = false;
+    char schar;
+    const char *special = NULL;
+
+    (void)memcpy((void *)&bits, (void *)&fval, sizeof(bits));
+    expo = (uint32_t)(bits >> 52U) & 0x7FFU;
+    mant = bits & 0xFFFFFFFFFFFFFULL;
+
+    /* The sign is taken from the sign bit, so -0.0 and negative NaNs print '-' like the C library. */
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-        a = *(long long int *)nump;
+    vlen  = (uint32_t)PrintGetSignChar((0ULL != (bits >> 63U)) ? -1LL : 0LL, flags_used, &schar);
+    left  = (0U != (flags_used & (uint32_t)kPRINTF_Minus));
+    zero  = (0U != (flags_used & (uint32_t)kPRINTF_Zero)) && !left;
+    pound = (0U != (flags_used & (uint32_t)kPRINTF_Pound));
 #else
-        a = *(int *)nump;
+    (void)flags_used;
+    schar = (0ULL != (bits >> 63U)) ? '-' : '\0';
+    vlen  = ('\0' != schar) ? 1U : 0U;
 #endif /* PRINTF_ADVANCED_ENABLE */
-        if (a == 0)
+
+    if (0x7FFU == expo)
+    {
+        if (0ULL == mant)
         {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
+            special = use_caps ? "INF" : "inf";
         }
-        while (a != 0)
+        else
         {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            b = (long long int)a / (long long int)radix;
-            c = (long long int)a - ((long long int)b * (long long int)radix);
-            if (c < 0)
+            special = use_caps ? "NAN" : "nan";
+        }
+        /* Zero padding does not apply to inf and nan. */
+        zero = false;
+        vlen += 3U;
+        nchunk = 0U;
+        top    = 0U;
+    }
+    else
+    {
+        /* value = mant * 2^e2, with the trailing zero bits dropped to keep the fraction short. */
+        if (0U == expo)
+        {
+            e2 = -1074;
+        }
+        else
+        {
+            mant |= 0x10000000000000ULL;
+            e2 = (int32_t)expo - 1075;
+        }
+        while ((0ULL != mant) && (0ULL == (mant & 0xFFULL)))
+        {
+            mant >>= 8U;
+            e2 += 8;
+        }
+        while ((0ULL != mant) && (0ULL == (mant & 1ULL)))
+        {
+            mant >>= 1U;
+            e2++;
+        }
+
+        if ((0ULL == mant) || (e2 >= 0))
+        {
+#if (defined(PRINTF_FLOAT_EXACT_ENABLE) && (PRINTF_FLOAT_EXACT_ENABLE > 0U))
+            /* No fraction, the integer part may need up to 1024 bits. */
+            for (i = 0U; i < PRINTF_FLOAT_WORDS; i++)
             {
-                uc       = (unsigned long long int)c;
-                uc_param = ~uc;
-                c        = (long long int)uc_param + 1 + (long long int)'0';
+                fract.word[i] = 0U;
             }
+            if (0ULL != mant)
+            {
+                i                  = (uint32_t)e2 / 32U;
+                fract.word[i]      = (uint32_t)(mant << ((uint32_t)e2 % 32U));
+                fract.word[i + 1U] = (uint32_t)((mant << ((uint32_t)e2 % 32U)) >> 32U);
+                if (0U != ((uint32_t)e2 % 32U))
+                {
+                    fract.word[i + 2U] = (uint32_t)(mant >> (64U - ((uint32_t)e2 % 32U)));
+                }
+            }
+            nchunk = ConvertFloatIntegerChunks(chunk, fract.word, PRINTF_FLOAT_WORDS);
 #else
-            b = (int)a / (int)radix;
-            c = (int)a - ((int)b * (int)radix);
-            if (c < 0)
+            /* No fraction, the integer part is exact while it fits in 64 bits. */
+            if ((0ULL == mant) || (0 == e2))
             {
-                uc       = (unsigned int)c;
-                uc_param = ~uc;
-                c        = (int)uc_param + 1 + (int)'0';
+                /* Zero or an odd integer, nothing to shift. */
+            }
+            else if ((e2 >= 64) || (0ULL != (mant >> (64U - (uint32_t)e2))))
+            {
+                zeros = ConvertFloatScaleInteger(&mant, (uint32_t)e2);
             }
-#endif /* PRINTF_ADVANCED_ENABLE */
             else
             {
-                c = c + (int)'0';
+                mant <<= (uint32_t)e2;
             }
-            a        = b;
-            *nstrp++ = (char)c;
-            ++nlen;
+            intword[0] = (uint32_t)mant;
+            intword[1] = (uint32_t)(mant >> 32U);
+            nchunk     = ConvertFloatIntegerChunks(chunk, intword, 2U);
+#endif /* PRINTF_FLOAT_EXACT_ENABLE */
+        }
+        else
+        {
+            shift   = (uint32_t)(-e2);
+            intpart = (shift < 64U) ? (mant >> shift) : 0ULL;
+
+            /* First pass: find the rounding direction and the run of nines it carries through. */
+            ConvertFloatLoadFraction(&fract, mant, shift);
+            for (i = 0U; (i < precision_width) && (fract.low < fract.words); i++)
+            {
+                digit = ConvertFloatNextDigit(&fract);
+                nines = (9U == digit) ? (nines + 1U) : 0U;
+                if (i < PRINTF_FLOAT_DIGIT_CACHE)
+                {
+                    digits[i] = (char)('0' + digit);
+                }
+            }
+            ndigit = i;
+            if (i < precision_width)
+            {
+                /* The remaining digits are zeros. */
+                nines = 0U;
+            }
+            else if (fract.low < fract.words)
+            {
+                digit    = (0U == precision_width) ? (uint32_t)intpart : digit;
+                half     = ConvertFloatCompareHalf(&fract);
+                round_up = (half > 0) || ((0 == half) && (0U != (digit & 1U)));
+            }
+            else
+            {
+                /* Exact, no rounding. */
+            }
+            if (round_up && (nines == precision_width))
+            {
+                intpart++;
+            }
+            intword[0] = (uint32_t)intpart;
+            intword[1] = (uint32_t)(intpart >> 32U);
+            nchunk     = ConvertFloatIntegerChunks(chunk, intword, 2U);
+        }
+
+        top = 1U;
+        for (i = chunk[nchunk - 1U]; i >= 10U; i /= 10U)
+        {
+            top++;
+        }
+        vlen += top + ((nchunk - 1U) * 9U) + zeros + precision_width;
+        if ((0U != precision_width) || pound)
+        {
+            vlen++;
+        }
+    }
+
+    if (!left && !zero)
+    {
+        cb(buf, count, ' ', (int)field_width - (int)vlen);
+    }
+    if ('\0' != schar)
+    {
+        cb(buf, count, schar, 1);
+    }
+    if (zero)
+    {
+        cb(buf, count, '0', (int)field_width - (int)vlen);
+    }
+
+    if (NULL != special)
+    {
+        for (i = 0U; i < 3U; i++)
+        {
+            cb(buf, count, special[i], 1);
         }
     }
     else
-#endif /* PRINTF_ADVANCED_ENABLE */
     {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-        ua = *(unsigned long long int *)nump;
-#else
-        ua = *(unsigned int *)nump;
-#endif /* PRINTF_ADVANCED_ENABLE */
-        if (ua == 0U)
+        PrintOutputFloatChunk(chunk[nchunk - 1U], top, cb, buf, count);
+        for (i = nchunk - 1U; i > 0U; i--)
         {
-            *nstrp = '0';
-            ++nlen;
-            return nlen;
+            PrintOutputFloatChunk(chunk[i - 1U], 9U, cb, buf, count);
         }
-        while (ua != 0U)
+        cb(buf, count, '0', (int)zeros);
+        if ((0U != precision_width) || pound)
         {
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-            ub = (unsigned long long int)ua / (unsigned long long int)radix;
-            uc = (unsigned long long int)ua - ((unsigned long long int)ub * (unsigned long long int)radix);
-#else
-            ub = ua / (unsigned int)radix;
-            uc = ua - (ub * (unsigned int)radix);
-#endif /* PRINTF_ADVANCED_ENABLE */
+            cb(buf, count, '.', 1);
+        }
 
-            if (uc < 10U)
+        /* Second pass: print the digits, applying the rounding found by the first pass. */
+        i    = 0U;
+        stop = round_up ? (precision_width - nines) : MIN(precision_width, ndigit);
+        if (precision_width <= PRINTF_FLOAT_DIGIT_CACHE)
+        {
+            for (; i < stop; i++)
             {
-                uc = uc + (unsigned int)'0';
+                cb(buf, count, (round_up && ((i + 1U) == stop)) ? (char)(digits[i] + 1) : digits[i], 1);
             }
-            else
+        }
+        else
+        {
+            ConvertFloatLoadFraction(&fract, mant, shift);
+            for (; i < stop; i++)
             {
-                uc = uc - 10U + (unsigned int)(use_caps ? 'A' : 'a');
+                digit = ConvertFloatNextDigit(&fract);
+                if (round_up && ((i + 1U) == stop))
+                {
+                    digit++;
+                }
+                cb(buf, count, (char)('0' + digit), 1);
             }
-            ua       = ub;
-            *nstrp++ = (char)uc;
-            ++nlen;
         }
+        cb(buf, count, '0', (int)precision_width - (int)i);
     }
-    return nlen;
-}
 
-#if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
+    if (left)
+    {
+        cb(buf, count, ' ', (int)field_width - (int)vlen);
+    }
+}
+#else
 static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t radix, uint32_t precision_width)
 {
     int32_t a;
@@ -757,6 +1150,7 @@ static int32_t ConvertFloatRadixNumToString(char *numstr, void *nump, int32_t ra
     }
     return nlen;
 }
+#endif /* PRINTF_FLOAT_FIXED_POINT_ENABLE */
 #endif /* PRINTF_FLOAT_ENABLE */
 
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
@@ -782,9 +1176,9 @@ static void StrFormatExaminedi(int *ival, va_list *ap)
 }
 
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-static void StrFormatExaminexX(uint32_t *flags_used, unsigned long long int *uval, va_list *ap)
+static void StrFormatExamineUnsigned(uint32_t *flags_used, unsigned long long int *uval, va_list *ap)
 #else
-static void StrFormatExaminexX(unsigned int *uval, va_list *ap)
+static void StrFormatExamineUnsigned(unsigned int *uval, va_list *ap)
 #endif
 {
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
@@ -803,27 +1197,6 @@ static void StrFormatExaminexX(unsigned int *uval, va_list *ap)
     }
 }
 
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-static void StrFormatExamineobpu(uint32_t *flags_used, unsigned long long int *uval, va_list *ap)
-#else
-static void StrFormatExamineobpu(unsigned int *uval, va_list *ap)
-#endif
-{
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-    if (0U != (*flags_used & (unsigned int)kPRINTF_LengthLongLongInt))
-    {
-        *uval = (unsigned long long int)va_arg(*ap, unsigned long long int);
-    }
-    else if (0U != (*flags_used & (unsigned int)kPRINTF_LengthLongInt))
-    {
-        *uval = (unsigned long long int)va_arg(*ap, unsigned long int);
-    }
-    else
-#endif /* PRINTF_ADVANCED_ENABLE */
-    {
-        *uval = (STR_FORMAT_PRINTF_UVAL_TYPE)va_arg(*ap, unsigned int);
-    }
-}
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
 static int32_t ConvertPrecisionWidthToLength(bool valid_precision_width, uint32_t precision_width, char *sval)
 #else
@@ -834,7 +1207,11 @@ static int32_t ConvertPrecisionWidthToLength(char *sval)
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
     if (valid_precision_width)
     {
-        vlen = (int)precision_width;
+        /* The precision is the most characters printed, the string may be shorter and need not be terminated. */
+        while (((uint32_t)vlen < precision_width) && ('\0' != sval[vlen]))
+        {
+            vlen++;
+        }
     }
     else
     {
@@ -854,15 +1231,16 @@ static int32_t ConvertPrecisionWidthToLength(char *sval)
  * (*func_ptr)(c);
  *
  * param[in] fmt   Format string for printf.
- * param[in] ap    Arguments to printf.
+ * param[in] args  Arguments to printf.
  * param[in] buf  pointer to the buffer
  * param cb print callback function pointer
  *
  * return Number of characters to be print
  */
-int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
+int StrFormatPrintf(const char *fmt, va_list args, char *buf, printfCb cb)
 {
-    /* va_list ap; */
+    /* The helpers take the address of the argument list, which is only portable for a local va_list. */
+    va_list ap;
     const char *p;
     char c;
 
@@ -894,6 +1272,8 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
     double fval;
 #endif /* PRINTF_FLOAT_ENABLE */
 
+    va_copy(ap, args);
+
     /* Start parsing apart the format string and display appropriate formats and data. */
     p = fmt;
     while (true)
@@ -945,16 +1325,16 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
 
         /* Now we're ready to examine the format. */
         c = *++p;
+        switch (PrintGetConversion(c, &radix))
         {
-            if (1U == PrintIsdi(c))
-            {
+            case (uint8_t)kPRINTF_ConvSigned:
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
                 StrFormatExaminedi(&flags_used, &ival, &ap);
 #else
                 StrFormatExaminedi(&ival, &ap);
 #endif
 
-                vlen  = ConvertRadixNumToString((char *)vstr, (void *)&ival, 1, 10, use_caps);
+                vlen  = ConvertRadixNumToString((char *)vstr, (void *)&ival, 1, radix, use_caps);
                 vstrp = &vstr[vlen];
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
                 vlen += (int)PrintGetSignChar(ival, flags_used, &schar);
@@ -962,48 +1342,61 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
 #else
                 PrintOutputdifFobpu(0U, field_width, (unsigned int)vlen, '\0', vstrp, cb, buf, &count);
 #endif
-            }
-            else if (1U == PrintIsfF(c))
-            {
+                break;
+
+            case (uint8_t)kPRINTF_ConvFloat:
 #if (defined(PRINTF_FLOAT_ENABLE) && (PRINTF_FLOAT_ENABLE > 0U))
-                fval  = (double)va_arg(ap, double);
+                fval = (double)va_arg(ap, double);
+#if (defined(PRINTF_FLOAT_FIXED_POINT_ENABLE) && (PRINTF_FLOAT_FIXED_POINT_ENABLE > 0U))
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+                PrintOutputFloat(flags_used, field_width, precision_width, ('F' == c), fval, cb, buf, &count);
+#else
+                PrintOutputFloat(0U, field_width, precision_width, ('F' == c), fval, cb, buf, &count);
+#endif
+#else
                 vlen  = ConvertFloatRadixNumToString(vstr, &fval, 10, precision_width);
                 vstrp = &vstr[vlen];
 
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-                vlen += (int32_t)PrintGetSignChar(((fval < 0.0) ? ((long long int)-1) : ((long long int)fval)),
+                vlen += (int32_t)PrintGetSignChar(((fval < 0.0) ? ((long long int)-1) : ((long long int)0)),
                                                   flags_used, &schar);
                 PrintOutputdifFobpu(flags_used, field_width, (unsigned int)vlen, schar, vstrp, cb, buf, &count);
 #else
                 PrintOutputdifFobpu(0, field_width, (unsigned int)vlen, '\0', vstrp, cb, buf, &count);
 #endif
+#endif /* PRINTF_FLOAT_FIXED_POINT_ENABLE */
 
 #else
                 (void)va_arg(ap, double);
 #endif /* PRINTF_FLOAT_ENABLE */
-            }
-            else if (1U == PrintIsxX(c))
-            {
+                break;
+
+            case (uint8_t)kPRINTF_ConvHex:
                 if (c == 'x')
                 {
                     use_caps = false;
                 }
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-                StrFormatExaminexX(&flags_used, &uval, &ap);
+                StrFormatExamineUnsigned(&flags_used, &uval, &ap);
+                if (0U == uval)
+                {
+                    /* Zero has no 0x prefix in the C library either. */
+                    flags_used &= ~(uint32_t)kPRINTF_Pound;
+                }
 #else
-                StrFormatExaminexX(&uval, &ap);
+                StrFormatExamineUnsigned(&uval, &ap);
 #endif
 
-                vlen  = ConvertRadixNumToString((char *)vstr, (void *)&uval, 0, 16, use_caps);
+                vlen  = ConvertRadixNumToString((char *)vstr, (void *)&uval, 0, radix, use_caps);
                 vstrp = &vstr[vlen];
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
                 PrintOutputxX(flags_used, field_width, (unsigned int)vlen, use_caps, vstrp, cb, buf, &count);
 #else
                 PrintOutputxX(0U, field_width, (uint32_t)vlen, use_caps, vstrp, cb, buf, &count);
 #endif
-            }
-            else if (1U == PrintIsobpu(c))
-            {
+                break;
+
+            case (uint8_t)kPRINTF_ConvUnsigned:
                 if ('p' == c)
                 {
                     /*
@@ -1014,35 +1407,55 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
                      * Orignal code: uval = (STR_FORMAT_PRINTF_UVAL_TYPE)(uint32_t)va_arg(ap, void *);
                      */
                     void *pval;
+                    uintptr_t pint;
                     pval = (void *)va_arg(ap, void *);
-                    (void)memcpy((void *)&uval, (void *)&pval, sizeof(void *));
+                    (void)memcpy((void *)&pint, (void *)&pval, sizeof(void *));
+                    uval     = (STR_FORMAT_PRINTF_UVAL_TYPE)pint;
+                    use_caps = false;
                 }
                 else
                 {
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-                    StrFormatExamineobpu(&flags_used, &uval, &ap);
+                    StrFormatExamineUnsigned(&flags_used, &uval, &ap);
 #else
-                    StrFormatExamineobpu(&uval, &ap);
+                    StrFormatExamineUnsigned(&uval, &ap);
 #endif
                 }
 
-                radix = PrintGetRadixFromobpu(c);
-
-                vlen  = ConvertRadixNumToString((char *)vstr, (void *)&uval, 0, radix, use_caps);
+                vlen = ConvertRadixNumToString((char *)vstr, (void *)&uval, 0, radix, use_caps);
+                if ('p' == c)
+                {
+                    /* Pointers have the 0x prefix like in the C library, the string is reversed. */
+                    vstr[vlen + 1] = 'x';
+                    vstr[vlen + 2] = '0';
+                    vlen += 2;
+                }
                 vstrp = &vstr[vlen];
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
                 PrintOutputdifFobpu(flags_used, field_width, (unsigned int)vlen, '\0', vstrp, cb, buf, &count);
 #else
                 PrintOutputdifFobpu(0U, field_width, (uint32_t)vlen, '\0', vstrp, cb, buf, &count);
 #endif
-            }
-            else if (c == 'c')
-            {
+                break;
+
+            case (uint8_t)kPRINTF_ConvChar:
                 cval = (int32_t)va_arg(ap, int);
-                cb(buf, &count, cval, 1);
-            }
-            else if (c == 's')
-            {
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+                if (0U == (flags_used & (unsigned int)kPRINTF_Minus))
+#endif /* PRINTF_ADVANCED_ENABLE */
+                {
+                    cb(buf, &count, ' ', (int)field_width - 1);
+                }
+                cb(buf, &count, (char)cval, 1);
+#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
+                if (0U != (flags_used & (unsigned int)kPRINTF_Minus))
+                {
+                    cb(buf, &count, ' ', (int)field_width - 1);
+                }
+#endif /* PRINTF_ADVANCED_ENABLE */
+                break;
+
+            case (uint8_t)kPRINTF_ConvString:
                 sval = (char *)va_arg(ap, char *);
                 if (NULL != sval)
                 {
@@ -1058,27 +1471,10 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
                         cb(buf, &count, ' ', (int)field_width - (int)vlen);
                     }
 
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-                    if (valid_precision_width)
+                    for (vstrp = sval; vstrp < &sval[vlen]; vstrp++)
                     {
-                        while (('\0' != *sval) && (vlen > 0))
-                        {
-                            cb(buf, &count, *sval++, 1);
-                            vlen--;
-                        }
-                        /* In case that vlen sval is shorter than vlen */
-                        vlen = (int)precision_width - vlen;
+                        cb(buf, &count, *vstrp, 1);
                     }
-                    else
-                    {
-#endif /* PRINTF_ADVANCED_ENABLE */
-                        while ('\0' != (*sval))
-                        {
-                            cb(buf, &count, *sval++, 1);
-                        }
-#if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
-                    }
-#endif /* PRINTF_ADVANCED_ENABLE */
 
 #if (defined(PRINTF_ADVANCED_ENABLE) && (PRINTF_ADVANCED_ENABLE > 0U))
                     if (0U != (flags_used & (unsigned int)kPRINTF_Minus))
@@ -1087,18 +1483,85 @@ int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb)
                     }
 #endif /* PRINTF_ADVANCED_ENABLE */
                 }
-            }
-            else
-            {
+                break;
+
+            default:
                 cb(buf, &count, c, 1);
-            }
+                break;
         }
         p++;
     }
+    va_end(ap);
 
     return (int)count;
 }
 
+static void StrFormatBoundedCallback(char *buf, int32_t *indicator, char dbgVal, int len)
+{
+    str_bounded_buffer_t *output = (str_bounded_buffer_t *)(void *)buf;
+    int i;
+
+    for (i = 0; i < len; i++)
+    {
+        /* Keep counting after the buffer is full, so the caller gets the complete length. */
+        if (((size_t)*indicator + 1U) < output->size)
+        {
+            output->data[*indicator] = dbgVal;
+        }
+        (*indicator)++;
+    }
+}
+
+/*!
+ * brief Writes formatted output to a buffer of limited size.
+ *
+ * param[out] buf  Buffer to store the output, can be NULL if size is 0.
+ * param[in] size  Size of the buffer in bytes.
+ * param[in] fmt   Format string for printf.
+ * param[in] ap    Arguments to printf.
+ *
+ * return Number of characters of the complete output, not including the terminating '\0'.
+ */
+int StrFormatVsnprintf(char *buf, size_t size, const char *fmt, va_list ap)
+{
+    str_bounded_buffer_t output;
+    int count;
+
+    assert((NULL != buf) || (0U == size));
+
+    output.data = buf;
+    output.size = size;
+    count       = StrFormatPrintf(fmt, ap, (char *)(void *)&output, StrFormatBoundedCallback);
+
+    if (0U != size)
+    {
+        buf[MIN((size_t)count, size - 1U)] = '\0';
+    }
+
+    return count;
+}
+
+/*!
+ * brief Writes formatted output to a buffer of limited size.
+ *
+ * param[out] buf  Buffer to store the output, can be NULL if size is 0.
+ * param[in] size  Size of the buffer in bytes.
+ * param[in] fmt   Format string for printf.
+ *
+ * return Number of characters of the complete output, not including the terminating '\0'.
+ */
+int StrFormatSnprintf(char *buf, size_t size, const char *fmt, ...)
+{
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+    count = StrFormatVsnprintf(buf, size, fmt, ap);
+    va_end(ap);
+
+    return count;
+}
+
 #if (defined(SCANF_FLOAT_ENABLE) && (SCANF_FLOAT_ENABLE > 0U))
 static uint8_t StrFormatScanIsFloat(char *c)
 {
@@ -1531,13 +1994,15 @@ static void StrFormatScanfHandleString(
  *
  * param[in] line_ptr The input line of ASCII data.
  * param[in] format   Format first points to the format string.
- * param[in] args_ptr The list of parameters.
+ * param[in] args The list of parameters.
  *
  * return Number of input items converted and assigned.
  * retval IO_EOF When line_ptr is empty string "".
  */
-int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr)
+int StrFormatScanf(const char *line_ptr, char *format, va_list args)
 {
+    /* The helpers take the address of the argument list, which is only portable for a local va_list. */
+    va_list args_ptr;
     uint8_t base;
     int8_t neg;
     /* Identifier for the format string. */
@@ -1574,6 +2039,7 @@ int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr)
     {
         return -1;
     }
+    va_copy(args_ptr, args);
 
     /* Decode directives. */
     while (('\0' != (*c)) && ('\0' != (*p)))
@@ -1703,5 +2169,6 @@ int StrFormatScanf(const char *line_ptr, char *format, va_list args_ptr)
             }
         }
     }
+    va_end(args_ptr);
     return (int)nassigned;
 }
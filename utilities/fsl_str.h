@@ -26,6 +26,29 @@
 #define PRINTF_FLOAT_ENABLE 0U
 #endif /* PRINTF_FLOAT_ENABLE */
 
+/*! @brief Definition to printf the float number with integer/fixed-point math instead of double arithmetic.
+ *
+ * The double is decoded from its bit pattern and converted with 32/64-bit integer operations, so no
+ * double-precision software emulation is pulled in on cores with a single-precision FPU. The digits
+ * are streamed to the output with the last digit rounded half to even. The output is exact for values
+ * below 2^64 whose fraction bits are all above 2^-96, see PRINTF_FLOAT_EXACT_ENABLE for the others.
+ */
+#ifndef PRINTF_FLOAT_FIXED_POINT_ENABLE
+#define PRINTF_FLOAT_FIXED_POINT_ENABLE 1U
+#endif /* PRINTF_FLOAT_FIXED_POINT_ENABLE */
+
+/*! @brief Definition to printf every float number exactly with the fixed-point conversion.
+ *
+ * When 0 the fixed-point conversion keeps a 96-bit fraction and a 64-bit integer part: fraction bits
+ * below 2^-96 are dropped, and integer parts of 2^64 and above keep their 20 leading digits with a
+ * relative error below 2^-52, followed by zeros. When 1 the conversion uses a 1088-bit integer and
+ * prints every value like the C library does, it takes about 250 bytes more stack and divides up to
+ * 34 words by 10^9 per 9 integer digits.
+ */
+#ifndef PRINTF_FLOAT_EXACT_ENABLE
+#define PRINTF_FLOAT_EXACT_ENABLE 0U
+#endif /* PRINTF_FLOAT_EXACT_ENABLE */
+
 /*! @brief Definition to scanf the float number. */
 #ifndef SCANF_FLOAT_ENABLE
 #define SCANF_FLOAT_ENABLE 0U
@@ -107,6 +130,35 @@ typedef void (*printfCb)(char *buf, int32_t *indicator, char val, int len);
  */
 int StrFormatPrintf(const char *fmt, va_list ap, char *buf, printfCb cb);
 
+/*!
+ * @brief Writes formatted output to a buffer of limited size.
+ *
+ * At most size - 1 characters are written, and the output is always terminated by '\0' if size
+ * is not 0. The return value is the length the complete output would have, so the output is
+ * truncated if it is greater than or equal to size.
+ *
+ * @param[out] buf  Buffer to store the output, can be NULL if size is 0.
+ * @param[in] size  Size of the buffer in bytes.
+ * @param[in] fmt   Format string for printf.
+ * @param[in] ap    Arguments to printf.
+ *
+ * @return Number of characters of the complete output, not including the terminating '\0'.
+ */
+int StrFormatVsnprintf(char *buf, size_t size, const char *fmt, va_list ap);
+
+/*!
+ * @brief Writes formatted output to a buffer of limited size.
+ *
+ * See StrFormatVsnprintf for the details.
+ *
+ * @param[out] buf  Buffer to store the output, can be NULL if size is 0.
+ * @param[in] size  Size of the buffer in bytes.
+ * @param[in] fmt   Format string for printf.
+ *
+ * @return Number of characters of the complete output, not including the terminating '\0'.
+ */
+int StrFormatSnprintf(char *buf, size_t size, const char *fmt, ...);
+
 /*!
  * @brief Converts an input line of ASCII characters based upon a provided
  * string format.
@@ -0,0 +1,320 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_timer_service.h"
+#include "fsl_lptmr.h"
+#include "fsl_wuu.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Hardware timer period when no software timer is running, it keeps the time base going. */
+#define TIMER_SERVICE_IDLE_TICKS 0x40000000U
+
+/*! @brief Gets the timer of a deadline queue element. */
+#define TIMER_SERVICE_TIMER(element) ((timer_service_timer_t *)(void *)(element))
+
+/*! @brief Checks if tick a is before tick b, the ticks wrap around. */
+#define TIMER_SERVICE_IS_BEFORE(a, b) ((int32_t)((a) - (b)) < 0)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/*!
+ * @brief Gets the current time, the interrupts must be disabled.
+ *
+ * @return Current ticks.
+ */
+static uint32_t TimerService_ReadTicks(void);
+
+/*!
+ * @brief Gets the wakeup time that satisfies the earliest timer and the timers due in its slack.
+ *
+ * @param now Current ticks.
+ * @return Wakeup ticks.
+ */
+static uint32_t TimerService_GetWakeupTime(uint32_t now);
+
+/*!
+ * @brief Restarts the hardware timer if the wakeup time changed, the interrupts must be disabled.
+ */
+static void TimerService_Reprogram(void);
+
+/*!
+ * @brief Fires the expired timers and programs the next compare, called on the compare flag.
+ */
+static void TimerService_Expire(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static list_label_t s_timerQueue; /* Running timers, sorted by deadline. */
+static uint32_t s_timeBase;       /* Ticks at the last reset of the LPTMR counter. */
+static uint32_t s_period;         /* Ticks from the last counter reset to the compare. */
+static uint32_t s_wakeup;         /* Ticks of the programmed compare. */
+static uint32_t s_wakeupCount;    /* Number of compare interrupts. */
+static volatile bool s_expiring;  /* Timers are being fired, the compare is programmed after them. */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t TimerService_ReadTicks(void)
+{
+    uint32_t count = LPTMR_GetCurrentTimerCount(TIMER_SERVICE_LPTMR);
+
+    if (0U != (LPTMR_GetStatusFlags(TIMER_SERVICE_LPTMR) & (uint32_t)kLPTMR_TimerCompareFlag))
+    {
+        /* The counter is reset on the tick after the compare flag is set. */
+        count = LPTMR_GetCurrentTimerCount(TIMER_SERVICE_LPTMR);
+        if (count != (s_period - 1U))
+        {
+            count += s_period;
+        }
+    }
+
+    return s_timeBase + count;
+}
+
+static uint32_t TimerService_GetWakeupTime(uint32_t now)
+{
+    list_element_handle_t element = LIST_GetHead(&s_timerQueue);
+    timer_service_timer_t *timer;
+    uint32_t wakeup;
+
+    if (NULL == element)
+    {
+        return now + TIMER_SERVICE_IDLE_TICKS;
+    }
+
+    timer  = TIMER_SERVICE_TIMER(element);
+    wakeup = timer->node.deadline + timer->slack;
+
+    /* Delay the wakeup to the end of the earliest window, but not past the window of a later timer. */
+    for (element = LIST_GetNext(element); NULL != element; element = LIST_GetNext(element))
+    {
+        timer = TIMER_SERVICE_TIMER(element);
+        if (TIMER_SERVICE_IS_BEFORE(wakeup, timer->node.deadline))
+        {
+            break;
+        }
+        if (TIMER_SERVICE_IS_BEFORE(timer->node.deadline + timer->slack, wakeup))
+        {
+            wakeup = timer->node.deadline + timer->slack;
+        }
+    }
+
+    return wakeup;
+}
+
+static void TimerService_Reprogram(void)
+{
+    uint32_t now;
+    uint32_t wakeup;
+    uint32_t delay;
+
+    if (s_expiring)
+    {
+        return;
+    }
+
+    now    = TimerService_ReadTicks();
+    wakeup = TimerService_GetWakeupTime(now);
+    if (wakeup == s_wakeup)
+    {
+        return;
+    }
+
+    delay = wakeup - now;
+    if ((int32_t)delay <= 0)
+    {
+        delay = 1U;
+    }
+
+    /*
+     * The compare can only be changed when the timer is stopped, which resets the counter. The part of
+     * the current tick already counted is lost, the time base falls behind by up to one tick per
+     * restart. It is not compensated, the phase within a tick is not visible to the service.
+     */
+    LPTMR_StopTimer(TIMER_SERVICE_LPTMR);
+    s_timeBase = now;
+    s_period   = delay;
+    s_wakeup   = wakeup;
+    LPTMR_SetTimerPeriod(TIMER_SERVICE_LPTMR, delay);
+    LPTMR_StartTimer(TIMER_SERVICE_LPTMR);
+}
+
+static void TimerService_Expire(void)
+{
+    timer_service_timer_t *timer;
+    list_deadline_element_handle_t element;
+    list_label_t rearmed;
+    uint32_t irqMask;
+    uint32_t now;
+    uint32_t deadline;
+    uint32_t elapsed;
+    uint32_t period;
+
+    s_expiring = true;
+
+    /* The periodic timers are re-armed once the pass is over. A period shorter than the coalescing
+     * window would otherwise fire again in the same pass. */
+    LIST_Init(&rearmed, 0U);
+
+    do
+    {
+        irqMask = DisableGlobalIRQ();
+
+        now   = TimerService_ReadTicks();
+        timer = TIMER_SERVICE_TIMER(LIST_RemoveExpired(&s_timerQueue, now + TIMER_SERVICE_COALESCE_TICKS));
+        if ((NULL != timer) && (0U != timer->period))
+        {
+            deadline = timer->node.deadline + timer->period;
+            if (TIMER_SERVICE_IS_BEFORE(deadline, now))
+            {
+                /* Skip the periods that are missed. */
+                deadline = now + timer->period;
+            }
+            (void)LIST_AddDeadline(&rearmed, &timer->node, deadline);
+        }
+
+        EnableGlobalIRQ(irqMask);
+
+        if (NULL != timer)
+        {
+            timer->callback(timer->param);
+        }
+    } while (NULL != timer);
+
+    irqMask = DisableGlobalIRQ();
+
+    /* A callback that restarted or stopped its timer has already taken it out of the re-armed list. */
+    element = (list_deadline_element_handle_t)(void *)LIST_RemoveHead(&rearmed);
+    while (NULL != element)
+    {
+        (void)LIST_AddDeadline(&s_timerQueue, element, element->deadline);
+        element = (list_deadline_element_handle_t)(void *)LIST_RemoveHead(&rearmed);
+    }
+
+    s_expiring = false;
+    now        = TimerService_ReadTicks();
+    s_wakeup   = TimerService_GetWakeupTime(now);
+
+    /* The counter restarted from 0 at the compare, the compare can be changed while the flag is set. */
+    s_timeBase += s_period;
+    elapsed = now - s_timeBase;
+    period  = s_wakeup - s_timeBase;
+    if ((int32_t)(period - elapsed) < 2)
+    {
+        period = elapsed + 2U;
+    }
+    s_period = period;
+    LPTMR_SetTimerPeriod(TIMER_SERVICE_LPTMR, period);
+    LPTMR_ClearStatusFlags(TIMER_SERVICE_LPTMR, (uint32_t)kLPTMR_TimerCompareFlag);
+
+    EnableGlobalIRQ(irqMask);
+}
+
+void TIMER_SERVICE_IRQ_HANDLER(void)
+{
+    if (0U != (LPTMR_GetStatusFlags(TIMER_SERVICE_LPTMR) & (uint32_t)kLPTMR_TimerCompareFlag))
+    {
+        s_wakeupCount++;
+        TimerService_Expire();
+    }
+    SDK_ISR_EXIT_BARRIER;
+}
+
+/* See fsl_timer_service.h for documentation of this function. */
+void TimerService_Init(void)
+{
+    lptmr_config_t config;
+
+    LPTMR_GetDefaultConfig(&config);
+    LPTMR_Init(TIMER_SERVICE_LPTMR, &config);
+
+    LIST_Init(&s_timerQueue, 0U);
+    s_timeBase    = 0U;
+    s_period      = TIMER_SERVICE_IDLE_TICKS;
+    s_wakeup      = TIMER_SERVICE_IDLE_TICKS;
+    s_wakeupCount = 0U;
+    s_expiring    = false;
+
+    LPTMR_SetTimerPeriod(TIMER_SERVICE_LPTMR, TIMER_SERVICE_IDLE_TICKS);
+    LPTMR_EnableInterrupts(TIMER_SERVICE_LPTMR, (uint32_t)kLPTMR_TimerInterruptEnable);
+    WUU_SetInternalWakeUpModulesConfig(WUU0, TIMER_SERVICE_WUU_MODULE_INDEX, kWUU_InternalModuleInterrupt);
+    (void)EnableIRQ(TIMER_SERVICE_IRQN);
+    LPTMR_StartTimer(TIMER_SERVICE_LPTMR);
+}
+
+/* See fsl_timer_service.h for documentation of this function. */
+void TimerService_InitTimer(timer_service_timer_t *timer, timer_service_callback_t callback, void *param)
+{
+    assert((NULL != timer) && (NULL != callback));
+
+    (void)memset(timer, 0, sizeof(*timer));
+    timer->callback = callback;
+    timer->param    = param;
+}
+
+/* See fsl_timer_service.h for documentation of this function. */
+void TimerService_Start(timer_service_timer_t *timer, uint32_t delay, uint32_t period, uint32_t slack)
+{
+    uint32_t irqMask;
+
+    assert(NULL != timer);
+
+    irqMask = DisableGlobalIRQ();
+
+    if (NULL != LIST_GetList(&timer->node.link))
+    {
+        (void)LIST_RemoveElement(&timer->node.link);
+    }
+    timer->period = period;
+    timer->slack  = slack;
+    (void)LIST_AddDeadline(&s_timerQueue, &timer->node, TimerService_ReadTicks() + delay);
+    TimerService_Reprogram();
+
+    EnableGlobalIRQ(irqMask);
+}
+
+/* See fsl_timer_service.h for documentation of this function. */
+void TimerService_Stop(timer_service_timer_t *timer)
+{
+    uint32_t irqMask;
+
+    assert(NULL != timer);
+
+    irqMask = DisableGlobalIRQ();
+
+    if (NULL != LIST_GetList(&timer->node.link))
+    {
+        (void)LIST_RemoveElement(&timer->node.link);
+        TimerService_Reprogram();
+    }
+
+    EnableGlobalIRQ(irqMask);
+}
+
+/* See fsl_timer_service.h for documentation of this function. */
+uint32_t TimerService_GetTicks(void)
+{
+    uint32_t irqMask;
+    uint32_t ticks;
+
+    irqMask = DisableGlobalIRQ();
+    ticks   = TimerService_ReadTicks();
+    EnableGlobalIRQ(irqMask);
+
+    return ticks;
+}
+
+/* See fsl_timer_service.h for documentation of this function. */
+uint32_t TimerService_GetWakeupCount(void)
+{
+    return s_wakeupCount;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_TIMER_SERVICE_H_
+#define _FSL_TIMER_SERVICE_H_
+
+#include "fsl_common.h"
+#include "fsl_component_generic_list.h"
+
+/*!
+ * @addtogroup timer_service
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief LPTMR instance used by the service. */
+#ifndef TIMER_SERVICE_LPTMR
+#define TIMER_SERVICE_LPTMR LPTMR0
+#endif /* TIMER_SERVICE_LPTMR */
+
+/*! @brief Interrupt of the LPTMR instance. */
+#ifndef TIMER_SERVICE_IRQN
+#define TIMER_SERVICE_IRQN LPTMR0_IRQn
+#endif /* TIMER_SERVICE_IRQN */
+
+/*! @brief Interrupt handler of the LPTMR instance. */
+#ifndef TIMER_SERVICE_IRQ_HANDLER
+#define TIMER_SERVICE_IRQ_HANDLER LPTMR0_IRQHandler
+#endif /* TIMER_SERVICE_IRQ_HANDLER */
+
+/*!
+ * @brief Frequency of the timer ticks in Hz.
+ *
+ * The LPTMR counts clk_16k with the prescaler bypassed, so that it keeps running in DeepSleep and
+ * PowerDown. clk_16k must be enabled for the core main domain, see CLOCK_SetupFRO16KClocking.
+ */
+#ifndef TIMER_SERVICE_CLOCK_HZ
+#define TIMER_SERVICE_CLOCK_HZ 16384U
+#endif /* TIMER_SERVICE_CLOCK_HZ */
+
+/*!
+ * @brief WUU internal module index of the LPTMR, to wake up from PowerDown.
+ *
+ * LPTMR0 is WUU internal module 6 in the WUU module table of the MCXA156 reference manual. The
+ * LPTMR interrupt wakes up the device from Sleep and DeepSleep through the NVIC, as the other
+ * peripheral interrupts do, PowerDown needs the WUU.
+ */
+#ifndef TIMER_SERVICE_WUU_MODULE_INDEX
+#define TIMER_SERVICE_WUU_MODULE_INDEX 6U
+#endif /* TIMER_SERVICE_WUU_MODULE_INDEX */
+
+/*!
+ * @brief Coalescing window in ticks.
+ *
+ * When the timer wakes up, the timers due within this window are also fired, earlier than their
+ * deadline, instead of waking up again shortly after. A periodic timer fires at most once per
+ * wakeup, a period shorter than the window is re-armed for the next one.
+ */
+#ifndef TIMER_SERVICE_COALESCE_TICKS
+#define TIMER_SERVICE_COALESCE_TICKS 16U
+#endif /* TIMER_SERVICE_COALESCE_TICKS */
+
+/*! @brief Converts milliseconds to ticks, rounded up. */
+#define TIMER_SERVICE_MS_TO_TICKS(ms) \
+    ((uint32_t)((((uint64_t)(ms) * TIMER_SERVICE_CLOCK_HZ) + 999U) / 1000U))
+
+/*! @brief Timer callback, called in the LPTMR interrupt handler. */
+typedef void (*timer_service_callback_t)(void *param);
+
+/*! @brief Software timer. */
+typedef struct _timer_service_timer
+{
+    list_deadline_element_t node;      /*!< Node of the deadline queue, internal use only. */
+    timer_service_callback_t callback; /*!< Callback of the timer. */
+    void *param;                       /*!< Parameter of the callback. */
+    uint32_t period;                   /*!< Period in ticks, 0 for a one-shot timer. */
+    uint32_t slack;                    /*!< Ticks the timer may be fired after its deadline. */
+} timer_service_timer_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initializes the timer service.
+ *
+ * Configures the LPTMR on clk_16k and enables its interrupt and its WUU internal wakeup module.
+ */
+void TimerService_Init(void);
+
+/*!
+ * @brief Initializes a software timer.
+ *
+ * @param timer Timer.
+ * @param callback Callback of the timer.
+ * @param param Parameter of the callback.
+ */
+void TimerService_InitTimer(timer_service_timer_t *timer, timer_service_callback_t callback, void *param);
+
+/*!
+ * @brief Starts a software timer, or restarts it if it is running.
+ *
+ * The timer fires between its deadline and the deadline plus the slack. The hardware timer is
+ * programmed to the latest time that satisfies all the timers due in the slack of the earliest
+ * one, so timers with overlapping windows fire in one wakeup. A periodic timer is rescheduled
+ * from its deadline, so the period does not drift with the slack.
+ *
+ * The LPTMR compare can only be changed with the timer stopped, which resets the counter. When a
+ * start or a stop moves the earliest wakeup, the fraction of a tick counted since the last tick is
+ * lost, and the time base falls behind real time by up to one tick (61 us at 16384 Hz). The
+ * expiry of the timers does not stop the counter, a periodic timer alone keeps its rate.
+ *
+ * This function can be called in a timer callback.
+ *
+ * @param timer Timer.
+ * @param delay Ticks from now to the deadline.
+ * @param period Period in ticks, 0 for a one-shot timer.
+ * @param slack Ticks the timer may be fired after its deadline.
+ */
+void TimerService_Start(timer_service_timer_t *timer, uint32_t delay, uint32_t period, uint32_t slack);
+
+/*!
+ * @brief Stops a software timer.
+ *
+ * This function can be called in a timer callback.
+ *
+ * @param timer Timer.
+ */
+void TimerService_Stop(timer_service_timer_t *timer);
+
+/*!
+ * @brief Gets the current time.
+ *
+ * The time base falls behind real time by up to one tick on each TimerService_Start and
+ * TimerService_Stop which moves the earliest wakeup, see TimerService_Start.
+ *
+ * @return Ticks since the service is initialized, wrapping around.
+ */
+uint32_t TimerService_GetTicks(void);
+
+/*!
+ * @brief Gets the number of hardware timer expirations.
+ *
+ * Compare it with the number of callbacks to see how many wakeups the coalescing saves.
+ *
+ * @return Number of LPTMR compare interrupts since the service is initialized.
+ */
+uint32_t TimerService_GetWakeupCount(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _FSL_TIMER_SERVICE_H_ */